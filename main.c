@@ -1,19 +1,24 @@
 /*
  * main.c
- * Version 20170803
+ * Version 20261019
  * Written by Harry Wong (RedAndBlueEraser)
  */
 
+#define _POSIX_C_SOURCE 199309L
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
+#include "perfcount.h"
 #include "sort.h"
 
 #define FALSE 0
 #define TRUE !FALSE
 
 #define ARRLEN 150000
+#define SAMPLESORT_THREADS 4
+#define SHAPECOUNT 4
 
 unsigned long int cmpcount = 0;  /* Number of comparisons made by the sort. */
 
@@ -23,6 +28,30 @@ int cmp(const void *a, const void *b) {
     return *(int *)a - *(int *)b;
 }
 
+/* Comparison function to determine the sort order without counting
+ * comparisons, for sorts that compare on several threads at once.
+ */
+int cmpuncounted(const void *a, const void *b) {
+    return *(int *)a - *(int *)b;
+}
+
+/* Integer key with the original index of its element. */
+struct record {
+    int key;    /* Key to be sorted by. */
+    int index;  /* Original index of element. */
+};
+
+/* Comparison function to sort records by their keys. */
+int cmprecord(const void *a, const void *b) {
+    int x = ((const struct record *)a)->key, y = ((const struct record *)b)->key;
+    return (x > y) - (x < y);
+}
+
+/* Key function to sort records by their keys. */
+long keyrecord(const void *a) {
+    return ((const struct record *)a)->key;
+}
+
 /* Print array of integers. */
 int array_printint(int arr[], size_t len) {
     size_t i, ret;
@@ -43,6 +72,59 @@ int array_printint(int arr[], size_t len) {
     return ret;
 }
 
+/* Sort the array of integers with typed merge sort. The comparison function is
+ * not used, so no comparisons are counted.
+ */
+void mergesort_int(void *arr, size_t count, size_t elesize, int (*cmp)(const void *, const void *)) {
+    sort_mergesort_int((int *)arr, count);
+}
+
+/* Sort the array of integers with a sort job in the background, and wait for
+ * it to finish.
+ */
+void sortjob(void *arr, size_t count, size_t elesize, int (*cmp)(const void *, const void *)) {
+    struct sort_job *job = sort_submit(arr, count, elesize, cmp, 0, NULL, NULL);
+    sort_job_wait(job);
+    sort_job_free(job);
+}
+
+/* Sort the array with sample sort on a fixed number of threads, so that the
+ * parallel distribution runs even on a machine with one processor.
+ */
+void samplesort_threads(void *arr, size_t count, size_t elesize, int (*cmp)(const void *, const void *)) {
+    sort_setthreads(SAMPLESORT_THREADS);
+    sort_samplesort(arr, count, elesize, cmp);
+    sort_setthreads(0);
+}
+
+/* Sorting algorithms to be tested. */
+struct algorithm {
+    const char *name;
+    void (*sort)(void *, size_t, size_t, int (*)(const void *, const void *));
+    int iscounted;  /* Boolean flag whether the performance counters count the threads sorting. */
+    int isparallel; /* Boolean flag whether the sort compares on several threads at once, so comparisons are not counted. */
+};
+
+static const struct algorithm algorithms[] = {
+    { "Built-in quicksort", qsort, TRUE, FALSE },
+    { "Comb sort", sort_combsort, TRUE, FALSE },
+    { "Quicksort", sort_quicksort, TRUE, FALSE },
+    { "Heapsort", sort_heapsort, TRUE, FALSE },
+    { "Shellsort", sort_shellsort, TRUE, FALSE },
+    { "Merge sort", sort_mergesort, TRUE, FALSE },
+    { "Typed merge sort", mergesort_int, TRUE, FALSE },
+    { "Sample sort", sort_samplesort, TRUE, TRUE },
+    { "Sample sort (4 threads)", samplesort_threads, TRUE, TRUE },
+    /* Comparisons of the sort job are counted without locking, which is only
+     * safe because one job runs at a time, so one worker thread compares at a
+     * time. Several jobs in flight would race on the count.
+     */
+    { "Sort job", sortjob, FALSE, FALSE }
+};
+
+/* Names of the input shapes to be tested. */
+static const char *shapenames[SHAPECOUNT] = { "Unsorted", "Sorted", "Reverse sorted", "Uniform" };
+
 /* Test whether the array is sorted. */
 int array_issorted(int arr[], size_t len) {
 	size_t i;
@@ -56,10 +138,164 @@ int array_issorted(int arr[], size_t len) {
 	return TRUE;
 }
 
-int main(int argc, char *argv[]) {
-    clock_t start, diff;
-    int diffinmsec;
+/* Test columnar sort on the random integers, with their original indices and
+ * halves as payload columns. Each row must keep its payload, and rows of equal
+ * keys must keep their order.
+ */
+void test_columns(const int arr[], const int sorted[], size_t len) {
+    int *keys = (int *)malloc(len * sizeof (int)), *indices = (int *)malloc(len * sizeof (int));
+    double *halves = (double *)malloc(len * sizeof (double));
+    void *cols[2];
+    size_t colsizes[2] = { sizeof (int), sizeof (double) }, i;
+
+    assert(keys && indices && halves);
+    for (i = 0; i < len; i++) {
+        keys[i] = arr[i];
+        indices[i] = (int)i;
+        halves[i] = arr[i] / 2.0;
+    }
+    cols[0] = indices;
+    cols[1] = halves;
+
+    printf("Columnar sort\n");
+    sort_columns(keys, len, sizeof (int), cmp, cols, colsizes, 2);
+    for (i = 0; i < len; i++) {
+        assert(keys[i] == sorted[i]);
+        assert(arr[indices[i]] == keys[i]);
+        assert(halves[i] == keys[i] / 2.0);
+        assert(i == 0 || keys[i - 1] != keys[i] || indices[i - 1] < indices[i]);
+    }
+    printf("\n");
+
+    free(keys);
+    free(indices);
+    free(halves);
+}
+
+/* Test distinct elements and group counts on the integers. The distinct
+ * elements must be the sorted integers without repeats, and each count must be
+ * the number of integers equal to its element.
+ */
+void test_group_count(const int arr[], size_t len) {
+    int *sorted = (int *)malloc(len * sizeof (int)), *work = (int *)malloc(len * sizeof (int));
+    size_t *counts = (size_t *)malloc(len * sizeof (size_t)), ndistinct, i, j;
+
+    assert(sorted && work && counts);
+    memcpy(sorted, arr, len * sizeof (int));
+    qsort(sorted, len, sizeof (int), cmp);
+
+    printf("Distinct elements\n");
+    memcpy(work, arr, len * sizeof (int));
+    ndistinct = sort_unique(work, len, sizeof (int), cmp);
+    for (i = 0, j = 0; i < len; i++) {
+        if (i == 0 || sorted[i - 1] != sorted[i]) {
+            assert(j < ndistinct && work[j] == sorted[i]);
+            j++;
+        }
+    }
+    assert(j == ndistinct);
+
+    memcpy(work, arr, len * sizeof (int));
+    assert(sort_group_count(work, len, sizeof (int), cmp, counts) == ndistinct);
+    for (i = 0, j = 0; j < ndistinct; i += counts[j], j++) {
+        assert(counts[j] > 0 && i + counts[j] <= len);
+        assert(work[j] == sorted[i] && sorted[i + counts[j] - 1] == sorted[i]);
+        assert(i + counts[j] == len || sorted[i + counts[j]] != sorted[i]);
+    }
+    assert(i == len);
+    printf("%lu distinct of %lu elements\n", (unsigned long)ndistinct, (unsigned long)len);
+    printf("\n");
+
+    free(sorted);
+    free(work);
+    free(counts);
+}
+
+/* Test counting sort on records of the integer keys. Counting sort must take
+ * the expected path, sort the records by key and keep the order of records of
+ * equal keys.
+ */
+void test_counting(const int keys[], size_t len, int path) {
+    struct record *records = (struct record *)malloc(len * sizeof (struct record));
     size_t i;
+
+    assert(records);
+    for (i = 0; i < len; i++) {
+        records[i].key = keys[i];
+        records[i].index = (int)i;
+    }
+
+    printf("Counting sort\n");
+    assert(sort_counting(records, len, sizeof (struct record), cmprecord, keyrecord) == path);
+    for (i = 0; i < len; i++) {
+        assert(keys[records[i].index] == records[i].key);
+        assert(i == 0 || records[i - 1].key < records[i].key
+            || (records[i - 1].key == records[i].key && records[i - 1].index < records[i].index));
+    }
+    printf("Path %d\n", path);
+    printf("\n");
+
+    free(records);
+}
+
+/* Test sample sort on several threads with integers of few distinct keys,
+ * which fill the equal to buckets, and with records whose count is not a
+ * multiple of the number of elements in a block, which leaves a partial block
+ * at the end of the array.
+ */
+void test_samplesort(const int arr[], size_t len) {
+    int *work = (int *)malloc(len * sizeof (int)), *expected = (int *)malloc(len * sizeof (int));
+    struct record *records = (struct record *)malloc(len * sizeof (struct record));
+    size_t reclen = len - 37, i;
+
+    assert(work && expected && records);
+    sort_setthreads(SAMPLESORT_THREADS);
+
+    printf("Sample sort (%d threads) with few distinct keys\n", SAMPLESORT_THREADS);
+    for (i = 0; i < len; i++) {
+        work[i] = expected[i] = arr[i] % 4;
+    }
+    qsort(expected, len, sizeof (int), cmpuncounted);
+    sort_samplesort(work, len, sizeof (int), cmpuncounted);
+    for (i = 0; i < len; i++) {
+        assert(work[i] == expected[i]);
+    }
+    printf("\n");
+
+    printf("Sample sort (%d threads) with %lu records\n", SAMPLESORT_THREADS, (unsigned long)reclen);
+    for (i = 0; i < reclen; i++) {
+        records[i].key = arr[i];
+        records[i].index = (int)i;
+    }
+    sort_samplesort(records, reclen, sizeof (struct record), cmprecord);
+    for (i = 0; i < reclen; i++) {
+        work[i] = records[i].key;
+        assert(arr[records[i].index] == records[i].key);
+        assert(i == 0 || records[i - 1].key <= records[i].key);
+    }
+    /* Every original index appears once, so no record was lost or repeated. */
+    for (i = 0; i < reclen; i++) {
+        expected[i] = 0;
+    }
+    for (i = 0; i < reclen; i++) {
+        assert(!expected[records[i].index]);
+        expected[records[i].index] = 1;
+    }
+    printf("\n");
+
+    sort_setthreads(0);
+    free(work);
+    free(expected);
+    free(records);
+}
+
+int main(int argc, char *argv[]) {
+    struct timespec start, end;
+    long diffinmsec;
+    int shape, j, tmp;
+    size_t i, ialgorithm;
+    int *shapes[SHAPECOUNT], *work;
+    struct perfcount pc;
     int arr1[ARRLEN] = {
         /*-106473957,-609955360,-188834473,943647637,-130569138,-270202872,-645744253,-470574280,-358944517,799544487,819997121,-102273461,729753288,414089358,984550466,-599829076,97007328,-816721894,590487150,537048647,-151045660,398801378,-822118185,-854086136,-187091963,-93022008,-141170077,598361188,-976365407,759667909,-321014008,731891751,89135523,619630302,946226837,-236847500,155458984,402870805,-237463287,-575513805,-484725111,-572891414,-407189089,-549445520,-181826667,-41190885,-323463350,47312051,424927341,967230182,26701183,296784504,-191393262,-979050318,-170640488,-280669992,-788394520,687655376,-483710301,734282534,608238851,-722494961,-286141816,492855604,-244267763,-113519686,-105534544,921294935,99813061,250384849,-810535304,-593834551,-740570023,-527627763,-627038473,671842890,-757085010,-234625226,958960470,-616863230,14978697,656396597,-457290051,786836152,115234744,756195931,191039222,238169228,438003248,756449882,-846462386,-211288659,737742660,-277997622,-114170285,39912509,-3590048,485030896,-4377013,102860101
         *//*-106473957,-609955360,-188834473,943647637,-130569138,-270202872,-645744253,-470574280,-358944517,799544487,819997121,-102273461,729753288,414089358,984550466,-599829076,97007328,-816721894,590487150,537048647,-151045660,398801378,-822118185,-854086136,-187091963,-93022008,-141170077,598361188,-976365407,759667909,-321014008,731891751,89135523,619630302,946226837,-236847500,155458984,402870805,-237463287,-575513805,-484725111,-572891414,-407189089,-549445520,-181826667,-41190885,-323463350,47312051,424927341,967230182,26701183,296784504,-191393262,-979050318,-170640488,-280669992,-788394520,687655376,-483710301,734282534,608238851,-722494961,-286141816,492855604,-244267763,-113519686,-105534544,921294935,99813061,250384849,-810535304,-593834551,-740570023,-527627763,-627038473,671842890,-757085010,-234625226,958960470,-616863230,14978697,656396597,-457290051,786836152,115234744,756195931,191039222,238169228,438003248,756449882,-846462386,-211288659,737742660,-277997622,-114170285,39912509,-3590048,485030896,-4377013,102860101,836987745,-4150694,-224431738,132965689,28036902,812458232,546937199,76163088,665092222,-224183281,44559427,686834263,-292723336,-331107846,112430732,432954760,-74888408,-600246092,200643677,136269459,778386087,662946446,112508247,438058229,236186649,-863657351,313376021,-450637167,335158503,588909270,-974115769,-385796733,285833762,275114636,960872109,-940268988,-123782175,-644773454,-364325879,880978806,525807033,-667841287,830863294,-848260557,-832164888,223753751,493962995,-622148204,902811099,890009282,-419750905,-897195891,-435842020,595720815,798488570,-717107625,-591700220,-635104231,600887693,-49047033,-733857028,-302779107,-676969665,426918603,-129084872,469576550,-130765909,-460223646,987939065,330539712,-668261825,-893959924,-433739639,-140412490,414094321,-483995286,-531734108,-894675920,25656427,-974408851,637811799,-460253308,-133866881,325232267,-973475297,338573181,-616395536,132781336,71766675,725683134,569788381,-708946918,-9910141,-893197694,130041800,57714625,-8456366,743706991,-152563110,187397125,-511760979,-940792433,562392936,-759926378,539430229,-444688838,-150937973,-278182324,-831183032,521001045,-665615845,-777599745,691665957,925352042,-191392728,367247047,-556879008,475612159,414763861,-579197103,133740038,637932801,720482604,95282739,779534367,-14860607,363330877,351976960,198891361,39994201,-260644957,-192345708,-761027501,599177427,-988107734,-238663006,908959646,-370646374,-657488155,710647979,213276964,32287682,932700546,93695753,838673591,401184403,-472909762,272741253,35394752,-240356714,82618527,-524105691,914862956,-35556173,36355376,766553586,-370163543,-489765067,-219899703,-971859885,-486044594,696445230,-86924060,-930564837,-942625227,482916937,81346585,694340804,-547354446,687111475,-775930492,60642069,-731351827,661150627,877681629,-739775642,827748893,549810394,-631727672,770430644,337975834,336769864,-649270682,587598355,579752949,-428687601,-112030366,471419854,701535623,40011650,650767392,355485933,65830335,-262446637,-537159772,242813415,-571857840,288311069,999237002,335967639,460293021,567466925,-691820496,-812691135,26422569,562580826,988722601,264806955,-864778557,559131738,-995191920,200808553,511749287,-663242305,-751693361,583884893,-472807488,694653121,318229835,348785385,688311769,-927312919,482952417,592627229,265735050,-165757533,-47211499,-8327748,-270248854,498952821,887856134,292416512,-484236448,-648228176,-131465944,-425315101,-373779525,298133191,649348551,-88973313,555633241,26575489,289434936,56776701,631096026,566452440,-667666616,-319832229,571322957,878264295,-291201703,560652938,-950564927,-536802844,-490871676,-350086447,-410276913,-217625788,-317845532,-953411397,-668251261,383758240,-670979558,-595433197,686962916,-487380502,-306797620,186821046,626090176,477760851,966583297,342656692,89478149,508973498,-339535007,918770034,423173945,384379262,-523439559,836444677,-59269910,-13189072,321843299,191984266,-65709871,-502604103,-987459848,-243426218,754340863,-155710581,695219312,-469762106,330951359,-236959371,-591415277,-290618907,-56815302,726038256,-901610951,-839517506,76511540,76907381,193339251,-22779977,-126891038,544809442,-81122500,412428807,-950864388,-312747678,-815541200,129072446,307184628,-114712048,-463293295,-511486101,-136880756,-325022035,208974589,561498655,851897806,-923040789,-813266920,496979136,710552953,-670572068,881412460,101812468,-538458318,-15780410,917333841,618530723,-179577824,-477684773,-868106438,-5919853,659559779,130143849,233000772,459962117,-308387944,-471544729,-504181765,787327204,-948607526,-165823908,-73962740,519166254,-478562197,-798431877,78124974,-474903181,487520675,298710220,86301815,199707913,151477597,-858456488,369387075,-73249530,-300702726,642296914,517692654,210120309,-302294827,-926340993,258528375,287366230,-842082360,67130836,-547955639,606488492,802334873,170266195,451127584,-874535918,-481634990,163216538,-869791407,-808330191,994716110,-865330653,-890147509,437683184,-393714912,13311070,-261904514,260793083,-519874587,-533733392,481785655,-79530544,-474171234,443829250,239142613,-983428806,-575273044,13895615,-333245771,268941210,79546986,-719901547,713969694,774126385,272579167,705154519,-989258777,-111861358,194800797,-659099776,264307939,533767807,-825260196,-743810056,-911186189,-934716807,-319104070,587576648,300005131,-208836666,-892790234,-370753488,-794880785,-499066148,-954421253,511848252,-493259631,-47841256,151065474,-195983815,-303380660,-376797971,620759941,974762971,22336971,-87328585,-667108503,-921541581,-674599731,457112849,-858225354,-109032792,-453186225,849240871,347517418,265467103,352175951,-577620556,-470471838,-294789905,304107913,653379597,-917737336,-634116194,-791365009,661131091,36567521,1112078,-856650766,-969885463,-914808346,-115438512,-113574865,76295729,-289692291,7054607,-323598197,-998905468,60920073,-634546871,-13395260,-31261870,-159564293,-890833617,-778594480,-200788298,-327248954,530870904,-545216865,861398546,-899030331,-954517927,666808821,-180816124,150092594,967826125,-425222840,-790966361,-226177731,-433597864,-464209446,-217975275,-273404581,-642136936,-573981053,815899803,-866556800,680057083,820145558,-167543586,758408127,-94800782,377319228,-378128431,883414220,-521629894,366278408,656128392,235884039,-437262382,-853894917,777780408,-930859223,-833554732,746237937,429733266,-594162276,-476297575,-465586361,18217434,242235098,774916856,-461985655,183865545,885768639,-263557131,331116865,-347430426,604441707,-191904947,636038352,529591596,380124458,187553042,-873072216,597589142,16627559,-224828587,632456534,-61829826,495562868,42952099,-108002115,-634296312,-941641792,341263465,746030229,438217203,607590643,-364967445,-84647408,-309169119,-501081495,-310477735,-893375428,825463059,247856627,-707628930,-728272248,-24549599,-691448728,-201854601,-337672740,-848563131,-214609650,-152572663,999092146,-724860995,143924921,851650263,-730997075,-921059270,450619402,560345374,-526152302,794839652,-505139599,-485462995,-343914216,-897957495,382229513,18398422,879444599,-70336607,-786372605,-310247605,598737813,216093520,783686906,-364548831,16316617,-237948272,-827374593,858757253,812279218,-557907831,-575576382,-998461741,-903208614,807728174,-321127231,-263485092,468482895,450985806,962850673,-550716084,530775055,880489401,-813959561,505378992,-255742922,655727586,835546642,678561310,635237784,437720404,784151629,-187488739,803712666,-281297334,-277395713,513485490,443363009,-186084190,213064160,-754490304,150745648,685876948,192554836,29698180,916501264,-495456437,-389468488,781885766,208391055,-569663024,-359976952,178665807,-937331954,743277669,439534957,-673479197,-552538183,736582402,296221062,700257150,135243043,-792505293,848454223,419656490,119012105,-927260168,655029325,-331102638,-925898765,-49871631,781280648,-798269649,-587488336,-430244322,506378370,-646267802,-674696815,-646201644,293523055,-419711695,-644270327,-574260343,-919590337,-209221039,-929626869,-602522655,68734309,-940235684,70683013,884816157,-101489553,406657267,994622461,309242866,-145904039,-156272445,160879119,569988948,-69796074,659189651,-91995465,-657930581,-853590053,21434636,981057150,870411621,855778461,-999067553,387816846,-220767688,986344552,175373017,954646503,967198788,-574034277,94892644,803823702,-818885523,348998623,524158083,-765761000,-77857785,975203381,-317160433,266378127,-515155753,-883217093,631193049,-828800338,-698334146,574943810,757547472,-592651872,1122455,-731415351,864564904,-552804513,71124372,-561098988,351838202,-427030192,805616667,955017860,650678374,-879096478,53875332,-50803658,-394124228,-711205379,588162790,-261029500,262717667,27070968,-539104126,932187711,403563435,435370571,-348499617,123308552,504674889,-312828154,170414641,713301438,583462755,224087523,-612682588,-615343044,586821343,-244006903,482662137,-176595090,660752414,-78032448,802732997,-689384186,307686372,-277323392,221030171,-243727442,-675852321,457196492,900587158,-709353123,952826476,5004058,358619658,-580163637,322241215,392299597,-683005486,-683515835,266513337,-716306843,451532668,-983992952,-796392323,-46434551,-180696249,438250791,396048889,333005315,718029673,99547324,523271856,629378379,325747487,-946931943,669602471,-756932265,-28720331,668547736,-872578420,2487445,-844515190,-765344920,-940005239,-351034019,-589627688,59159445,228233033,445837848,585502552,-430066971,139736223,909774664,-696019615,492859351,-605326873,811138998,669499945,-998530039,-989478080,44935264,-771641083,779854990,401870753,-901300069,325404568,412315828,-154222242,-444764380,605419772,-669539159,375393368,922660321,-964059261,747476697,283089360,194078500,-44098969,-588113285,-873773057,67926889,-209236433,-557693561,-172879263,685691721,-187925305,-881471258,753878891,898979015,-432479106,-345618084,364313532,-657166351,635742691,502899410,-596292773,606157471,-315185098,867578839,462054076,920911398,-86107700,524612170,-63259772,-904601400,-822335276,906376674,-680005950,882495553,-475793103,482729807,-110994493,-432769386,-129767149,341121383,-721258902,-384531754,348587540,-600946810,-972883761,37666590,100658854,-792065648,646078448,-107221433,651242111,721208375,205128613,499319193,567138440,960067186,635635065,-353213502,-580134805,541338132,530085763,122930800,-603251271,-789887134,510815902,244100846,135732357
@@ -99,33 +335,92 @@ int main(int argc, char *argv[]) {
         -591860897, 918448703, 152711227, 71324468, 807386218, 881423484, 527802424, 781923429, 996263963, 700761043, -319548138, 51606169, -162924175, 287065667, 187593691, -187932835, 466739785, 21232583, -512942299, 593630648, -5194407, 641118394, 964554214, -491019594, -922504884, -267575483, -895344074, -258753384, 989342224, -215513735, -430539051, -700517698, -405048226, 462371540, -164739762, 749522776, -339753877, 420703376, 924463811, -293740376, 724694663, -597175114, 121047780, 817675529, -994388205, 650915943, -886227619, 663775411, 359806700, 307710510, -54660060, 66457738, 568964708, 797905513, 972758539, -138280917, -435727956, 182108014, -484713209, -90936903, 627492193, -910455170, -236339501, 834102304, 788382800, 654315808, -249752930, 413196394, 447050965, 779093485, -514619399, 315248285, -459525914, 93440251, 888998011, 702456163, 717445551, 977021208, 636063191, -341491001, -656667155, -55215979, -933826035, 460971916, -582212357, -779059963, 784569020, -20368609, -179713961, 374035819, -419459747, -393925185, -143946639, 742255550, 418781695, -564709587, 713646647, 922149869, 301192183, 128731846, 748815315, -819112534, -187987541, 636425614, 821934662, -847550147, -989240833, -63143374, 800080091, -923092386, 551505639, -53246295, -804635870, -692349336, -203282715, -634455618, 381307526, -923407667, 811369247, -75913578, 82276772, -269539893, 791639077, -854223740, 201478467, 721591535, 891279017, 715750021, 656687269, -679947506, -336414928, -634730355, 137300822, 893945152, -82177915, -584688921, -802261486, -313369913, 736885280, -950396061, 400285975, -914868325, -134533579, 116050566, -747425783, -496880440, 860393069, 9254648, 432115054, -420933393, -759546389, 892995157, -257688611, 309851715, 778284313, 196486385, 334646963, 295781881, 486813326, -819102765, 631952573, -650668316, 910096926, -397738183, 121269788, -819090590, -603454066, 19220909, 844757035, 841134905, 41374627, 860394865, -107166118, 316715431, 464208686, -673541796, -958669642, 129640169, -263940637, 747661818, 763252626, 255054206, 47902601, -368464731, -470890807, -922496155, -212336705, 343614395, 86201010, -491402615, 995654786, 944653258, 188331213, -186018018, -267894327, -593344742, 485640389, 629801188, -356611903, 179062762, 477361936, 145792789, -581535356, -141714989, -804137743, 771650101, -405876112, 701977238, 44602363, 987943671, -280870961, -521408095, -907857001, -449531265, 445972124, 908826332, 729375150, -93611336, 921919343, 736550242, 625416963, 978380146, 310743761, 815277619, -253666142, 762441840, -145005117, 616114669, 957413269, -364237361, -903436336, 683130114, 130071603, 905457709, 388598728, -36983509, 913367482, -591675591, 129080663, -537338816, 708786579, -150664671, -903902006, -460793411, -175714330, -122465741, -978196109, -32026419, 380408807, -638405541, 30748306, -567262071, -321709014, -723973966, 163258118, 69881616, 963943887, 217365994, -27886341, 684996008, 168809539, -767018174, -14363683, -276399757, 989099150, 871490970, 249579768, 955693626, -132027811, 208015837, -418859834, 235524683, 675230471, 259349515, 272926216, 156486415, 328083528, -402772070, 472314960, -982559623, 543946141, -610729159, 374369390, 180972738, -690893140, -640388511, -596905255, 882679034, 332696844, -485871224, 855919691, -257292451, 701102385, 66692974, 946816693, -279804712, -666928354, 554027233, 591955242, 182774275, 497134846, -717332279, -309198942, -824729602, 316084713, 9221839, 368560470, 856612240, 453944168, 774965468, -265872130, 647549780, 268811080, 796165888, 667387563, 307366793, 696523455, -866475744, -498977467, 226423853, -328685205, 68773791, 647800663, 246785178, 287746631, -691837676, -902198520, 651527594, -20058111, 583764966, 354509618, 579180543, -427356828, 939635531, 932107178, 869727128, 740818333, 138624485, 550561239, -75145989, 805185185, 377086565, 235673656, -572352008, -370788400, 101270863, 349845651, 933217923, 844360103, -117858583, -21372201, -182257435, -75683333, 827461906, -126289909, -863808726, -166658439, -996941018, -808817852, 278062824, 730370969, -780672560, -45991138, -361998606, 62705267, -839170371, -467632970, 421217944, -927934634, 575030217, -603828667, 141813357, -136944657, 106852560, 439062340, -635745309, -449037022, 934192349, -92856238, -659931814, -67952180, -548061869, -926381340, -455133980, 161438916, -486914006, -490045131, -470708333, -108692393, 14293744, 746124467, -306745334, -760807534, 54057436, 630541415, -724379697, -101403671, -547344677, -790316279, 358528680, 407570375, -984999547, -734016922, -358299887, -237232983, -690341327, -428224002, 305158132, -518852150, 33446558, -131184874, -325719442, 620697241, -267010294, 748752657, 515428162, 576846829, 43978224, -415312022, 500152027, 473253068, 405737146, 963666671, 922156870, 890345089, -16428332, 825975084, -319958400, 925618415, -541734759, -483168362, -999551587, 482369919, 659776597, 340888145, -837952423, -744689174, -5180102, -499234786, 815804612, 57987388, 614620426, -537294955, 44957439, -137077117, 561950833, -289367196, 663216963, -569632403, -264524363, -668183413, -188430236, -102161116, 459180026, -294966702, -29704079, -361155727, -982126392, -807853981, -549367721, -113017202, 383045897, 536502583, -503343287, 941208768, -216555802, 69979484, -285447376, -998802218, -612189058, -836577466, 360039716, -689634570, -261085804, 337089021, 998358130, -782835029, -996661942, -465626076, 492183830, -827166432, 563399753, 767707933, 329944430, 56968228, 676706329, 337129099, -19234242, -823139174, -56491665, 821153194, 375406829, -593230014, -811332723, 346860057, 93899856, 5992131, 249096398, 589451963, 366831721, -770804343, 644392204, 600719011, 512269427, -179917787, -523365487, -244458168, 202129425, -897278243, -160129303, -675120869, 690585606, 580358866, 482624334, 795145803, -514213413, 819029094, -453845842, 17488729, -571559222, 554694083, -860917496, 820212422, -754949638, -379770467, 917830284, 370175668, 719862551, 313505100, -508866902, 351153507, 196581095, -290540251, -803210852, 121492521, -295073929, -88057282, -233830358, -979440957, -74748654, -601544690, -4332436, -226447726, -169658835, -219470392, 65547685, 715408123, -380751962, 944329297, 36174409, 991573222, 716160003, -280710961, 635189351, -999369006, -344734057, 698771173, -853615669, 125611671, -56505279, 627334308, -344150013, -21535303, 392284131, -393009379, 337498926, -87160202, 814401188, -968493424, 965174610, -621861134, 281861496, 8899492, -104875515, -782329068, 960883803, -775913949, 778134022, -809666344, -533786046, 932108206, 76342557, -410046739, -371407760, 432452477, -439325205, -432700489, -63913115, -831569772, -794810045, 373825228, -245489287, 963224526, 243839158, -884649864, 868849903, -227907483, -650273237, -344082472, 346056699, -147315075, -363691584, 787693309, 834124013, -311908294, -964853062, -283595103, -224914486, -776810189, -702587215, -198435528, 240521860, 170004946, -807678092, 875696760, -289306042, -156415459, 82113224, -834474543, 413745040, -375907335, 162886433, -486839401, 973892969, -387155316, 580408243, 432195225, -315450684, -495661730, -593222471, -795831227, -173276850, -515289483, -770715847, -546017491, 142745865, -82557319, 770160267, -601264433, -625035839, -271848197, -81018057, 507110194, -134250507, 777160047, 753378124, 420264925, 67245141, 418526969, -484553678, -847924900, 457752025, 438572889, 820811285, -334172870, -921737179, -376374171, 146987484, -515340477, -342085009, 711944298, -956113871, 971499731, 679810586, 648991442, -899121450, -344598638, -38942430, 371042958, 135135456, 818020667, 539447692, -458723715, -425460856, 992932690, 385659032, 11102846, -357508178, -559293970, -948191840, 310736645, -982212414, 776366906, -896214643, -237346270, -888338624, 405916421, -234152767, 833244823, -580201212, -559392230, 290596871, -308115915, -897893352, 436351836, -979326588, 610921562, -613368899, -611595587, 553174526, -75526797, 994967712, 984133348, -81698541, 809194383, -636787006, -142065710, 76040120, -400850200, -60543696, -823598587, 872927300, 319967190, 467669451, -823990582, 888965693, -108466166, -827375587, -386843018, 416660906, -594436350, 53495301, 70686899, 583656181, 628577147, 63040865, 773864766, -302723310, -995817610, 149855175, 817788558, 109173899, -617814891, 823540364, 444558866, 731714129, 428528504, 293204174, 416656294, -815559761, -580799039, 450356755, 952685179, -800514155, -198665872, -426474986, -986885094, 596936153, 523120270, 666925447, 590667454, -702610381, -221979320, -411990037, 466412911, -433558349, 223877401, 846638581, 979697442, 882401103, -695698618, -286607179, 22208846, -612570695, -698288019, 522160980, 18698738, -591842204, 588514172, -429055983, -522375488, 779646243, -829526439, 722010905, -23131307, 322435309, 691240077, -524088812, -911675344, 128705533, 873995637, 881123834, -268206890, -523857641, -981886448, -844744928, -611684991, -259559333, 190595653, 961461347, -828611912, -348299347, -233501792, 502914387, 856259561, 810310933, 547676506, -9281069, 28406372, -648399652, -604792126, -741032170, 400537675, -262666044, -917066242, -75570508, 422280799, 224148897, -566165545, 522032163, 43544783, -915026035, 915104918, 192659486, -20597837, 188984269, 893531583, -996005779, -554478509, -715272057, -439472650, 568836588, -393135737, -745387793, 194231440, -511255258, 409877236, -742742838, 303521396, 960004788, 883203695, -78184138, 104968304, -301393271, -86111276, -987779979, -668426983, -626955374, -749817244, 798681569, 107880315, 685042633, 797617086, 707682478, -663638002, -536108303, -983553000, -830617785, -379876447, -498159710, -451604997, 245213591, -331273924, 773200708, 698055837, -797485025, 385286625, 482937223, -690526914, 523771487, -838765514, -509869433, 684659167, -727307493, 813930705, -124526309, 940980667, 404555908, 247387817, -410807529, -744809515, -742634819, 247853862, 192885861, 155600520, -942491048, -463925882, 516089462, -295216642, -395646961, 75189688, -35418606, 489585211, -236775338, 101079392, -227058004, -979984488, 682222029, -243025819, 909608720, -824034552, -68897254, -955689269, 489207847, 723400530, 707850107, 192262824, -962108249, 609854406, 281395728, -538821680, 342263869, -751896671, -954248025, -313728114, -769818064, -632452784, -506216133, 30936555, -656069260, -341886130, 864081817, 329784534, -685148103, 183800060, -581714752, 199962731, 609717992, -719070719, -661856208, -911780033, -230204452, -449421757, -580383426, -215918321, 394240843, -799360192, -752157053, -318404792, -61229176, 738256382, 131103630, -390738008, 855589717, -28332633, -820292885, 813317821, -579063960, 179244417, -586043791, 293580229, 137947770, -234150035, 384158512, 349277405, 711540797, 349112820, -739168574, -427357490, 669648087, 443218782, 769960454, -767306998, -71250496, -276639961, 548862983, 318650484, -980955341, 781306468, 149285714, -408399504, -546604931, 950710511, 815040987, 55244981, -697625849, -264509901, -378127827, 615669560, -229974985, -430524383, 475065512, -905005583, -569284409, 263428725, 387586115, 791841933, 409461966, 404429429, -425443634, 125896629, -22299786, -795504078, -838245402, -246320256, -851705728, -674029236, 732854434, 894787207, -866285718, 710486330, 296217450, -58973878, 690427553, -574353935, -846083345, -435750966, 795189232, 96345616, -966547476, 142330230, 951517317, -937516426, -326971291, 622647653, -879274249, 220217865, -713604615, -155697215, -186440749, -1305535, -63922614, 306736966, 755784545, -934430060, 944082153, -423882973, -771450922, -183301152, -820301833, -250731661, -420547027, -609679956, -197012343, 40386894, 58656857, 325163147, 240373867, 898960409, -683594842, -476677282, 6648073, 246759939, 65717764, 802617832, 408732111, 30329948, 154591102, -513745803, -785315738, 903874094, -171491684, -861687548, -347965035, -427544556, -524510032, -721593826, -924030665, -266134350, -953951792, 529244198, 293361857, 148042437, -469227461, 418676340, -341885555, 591874347, -454200603, -46518216, -190535616, 2968769, 904233139, -142718206, -751591572, 80959154, -526807739, 876527234, -317306165, -530998963, -933200547, 228662075, -265366092, 703804722, 59296298, -788260447, 703732395, -127698942, -72863907, -308494026, -1018628, 90933176, 959020963, -332958388, 83817168, 639084691, -113416768, -98933480, -851494877, 679419991, -523392429, -765909021, -49232599, -701850577, -73269407, 174112258, 309017900, -264563596, 242966536, -381001525, 499533864, 931290749, -983483012, 21381676, 965851938, 405141175, 681958312, -385808963, 337198163, 486416877, 516868840, -476488269, -336245608, -657803403, 795993628, -370319841, 781965095, 307300816, 857822376, -920045661, 51495903, -346622756, -727896908, 396340849, 709935152, -884881428, 875944875, 273660691, 920219067, -335602097, -538957613, -986744629, 33739978, 844550786, 596702621, -168771461, -603471392, 865017887, -754182614, 907462656, 802965219, 150755362, 52850662, -777837680, 229755864, 515431283, -457092501, -442471217, -110170560, 70865605, 909396088, 205145818, 18788861, 853427524, 345832061, 958003342, 287975619, -182249044, -960219487, 639496354, 336567528, -948632837, 263884557, -962307147, -738147248, 34347182, -419656585, -17716115, -845339972, 931159821, -543806210, 129278727, -624082917, 80209186, 64493756, 456721779, -567218352, -417144434, 267624517, -77469915, -424460435, -615948788, 134571974, -928272248, -712396649, 682513254, -761000116, 98605092, 898097877, 188394559, 714036091, 208599891, 910324459, 767769847, -432547174, 361868187, 694417068, 696050521, -112323023, 66043664, -882718831, -709859469, 89712744, -23756192, -184856003, -900373678, 747639322, 770142895, -49584425, -39936656, 671861647, 720339519, 240575360, -868064372, 595831999, -313921773, -599510521, -185368943, 195825866, -950110157, -656114153, -944329260, -689608762, 809591096, 525497378, -717338016, 541070224, 552788124, -4785283, 22322905, -840362521, 254248331, -741250796, -367675049, -872820915, -758996991, 631965982, -897381421, 262448711, 834010614, -841225945, 168770729, -965652204, -85903692, -570905758, -861692354, 92252468, 716654594, -429166969, 40285226, -41594134, -418559915, -717184318, 709654654, -950665484, -388560632, 820865069, -761015669, -302095589, 270883149, 657827225, -813354347, 914557083, 555229054, 729352187, 932044682, -22105466, 221503516, -794459672, -834554747, -489592738, 520575548, -691210432, -525527908, 515283520, -302197121, 360505359, -729940015, 787538034, 940549597, 314740382, -174644676, 61513441, 676798241, -266733448, 75917257, 200792440, -294280964, 452120723, -92719733, -195513644, 852626550, -210366024, 104126809, 57136369, 712356340, -258381766, -541031358, -878444512, 365173323, -969252337, 472312446, 453449707, -770567856, 445228046, -271836186, 959134285, 93285695, 152095973, 824623220, 928262454, 147131155, -446819319, 95291512, -2675841, -743909927, 104192089, 821054563, -881683405, -116532429, 666578563, 857125073, 483458301, -479898723, 300208843, -39197377, 804248843, 336383170, 405786948, 566277022, 441114153, -361029507, -329877468, 689558598, 615976780, -54587814, 527492870, 57516969, -230306436, 277735842, -908709938, 371550711, -43261854, -57635204, -675655417, -138893442, 357750479, -902725496, -65225969, 577650351, 285695827, 471436764, 895419947, -970782415, -808881228, -128229320, 145683625, 303893850, 718408147, 426701997, -53322603, -643127737, 937611312, -825310914, 198737213, 742391482, -751083796, 995851974, 970657427, 398215350, -37550434, -192058059, -863506456, 34476238, 905449939, 823933302, 752046594, 417986370, 558352198, -374913692, 623589030, 118282390, -970748510, -965974797, -815201771, 942113119, -991025384, 926714183, -932402281, 71823977, -725831063, -856659396, -294024158, -767984786, 729857099, 380873318, -593152549, -793549913, 572753031, 602947975, -471634201, 801797009, 174957241, 504799329, -589320037, 419663095, 210562843, 147985942, -157515267, -838404972, 638174475, -480810445, -139975400, -171560285, -186229696, -48250726, -886730212, -343444263, 44076088, 262653381, 40332773, -214638031, -261810193, 364286770, -77332143, 607141709, -426000771, -663749226, 996292273, -299734837, -765111963, 472735931, -678836754, -99157883, 841936964, 206105371, -732893603, -147052952, -954092268, -260921367, -41390430, 696065987, -775097263, -340936127, 812042213, 455044335, 650680530, -398232780, 7801578, 588125858, 437116960, -557871114, -467706758, 92880109, -918723550, -618358318, -444317721, -973349907, 285021782, -365494817, 550094117, 20867230, 56587485, 253020484, 463042540, -308296708, -710077923, -372513703, -353833127, -82873228, 962176716, 338293525, -127192000, -651716821, -69677948, 885457842, 736309286, 772996962, 87692491, 920843588, 468381393, 631901865, 156448391, -879247413, -402224182, 844684805, 97876307, -144507610, -701119925, 682364317, 948483450, 773179217, 990905885, -751565885, 675944253, 64979902, -488391349, -148336920, -764489451, -904030341, -748157783, -918728082, 391225664, -896745639, -506390542, -621678392, -952624379, 967130782, -779688389, -779672201, -878755581, -675312437, -322537168, 548300825, -591362066, 419533171, -237404958, 80826752, 802154700, -582874225, -817114615, -290912076, -490929796, 139456161, 273030716, 6132459, 828158156, -116327680, -568645219, -514155558, -689400873, -836146952, -287893912, -327927607, -182199502, -336172095, -127237873, -443341182, 326531229, -984315448, -707894873, -342976376, -520760611, 596740029, -841101881, -559515378, -71420081, 478170934, -916221791, -620647487, -978343413, 221708952, -295435608, 195748736, 966385190, -923283020, -459385414, 267097051, 782930270, -674029801, 656794380, 322508515, 140834934, 699264854, -101473123, 311741116, -998985129, -377828378, -733665828, -416900684, 525269974, 33814636, 16253638, -700768683, 405191618, -596220917, -247327068, 387079967, 246611958, -402398183, -542274858, -895450047, -761517837, 409519324, 770443790, -60578226, -305237818, -609452081, -745823371, -409754558, 282187762, 568308476, -948959826, -31949674, -609652010, 291709579, -442235481, -326227311, -599927, 548310016, 673829673, 185578268, -816491193, -15253121, 459523334, 398775490, 198902590, 362021536, -591143302, 279490432, -456371405, 524942254, -656354872, -420772329, -697161873, -867477747, -656774490, 800525376, 573994335, -298943313, -243397496, 921551779, 444800001, 73318356, -404135638, -755508165, 603220137, -587887279, -325157243, 389515357, -983737663, -245315724, -204057646, -359210112, -427138137, -344636968, 175395163, -775340665, -147264675, 700261496, 81912501, -509214191, -752762820, 746749696, -189432906, 724291380, -326419179, -443748710, 527604070, -307182451, 853794620, -320721210, 135115633, -742641043, -480351928, 805839988, 848607577, -782185384, -296353019, 586131187, 292826648, -904421510, 122435146, -826290921, -795524945, 691468195, 620455928, 254260850, 118567495, 913515757, 737228305, -402529194, -183671788, -539147242, -399054382, 777924694, 763303661, 541860481, -471073568, 820834453, 762571556, 306408696, 438892378, 469006372, 583862819, 965520455, 733503419, 216543909, -494968772, -13700734, 4237221, 420896092, -700072871, 900444314, 430355617, 742710368, -964212503, 816631192, -692140705, 776770460, 141101615, 640978498, 329690924, -560384071, -339201192, -549843704, -283803990, -464481603, 779173673, -78258502, -563650248, -293302622, 342991686, 272345115, 309219074, 844389918, -352146349, 129863840, 595358757, -106705862, -347189641, -111774217, 229375818, 287194834, -648967853, 567999266, 162900427, -195341711, 804227040, 281457729, -33458407, 27811899, 221492481, 622810552, -709542905, 725113873, 48268012, -903727166, 732914938, -617786337, 395366925, 520540558, 639670136, 513873629, -799036665, 378251295, -427283764, 363037736, -459804907, -421662796, 733758115, -407590412, 859121023, -620317402, -689280085, 262773174, -398881286, -637301646, 408612520, -142776705, -476645138, 883326847, 45495317, 371300511, 515423685, 564401698, -618454228, 602465032, -579489208, 311096744, -835440142, 217816024, 249295874, -442765503, 835542567, 751278710, -339869119, 123965418, -746188503, 415938689, -709538087, 713286238, -927883981, 143431308, 758735576, 598246333, 20585995, 6920670, 388658200, 912727857, 496371057, 415128837, -410141444, -615618199, 507826860, -634994041, 809983568, 916784071, 789775865, -251355592, -203291746, -392271106, 11492196, 904911922, 896090030, 959851977, 386891430, -673948541, 814757654, -882790694, 429233028, 651968443, -875130235, -549929423, -774364607, 190187633, -304524408, 421992469, 77351809, -855090796, -402025418, -28437586, 638212402, 82264851, -508431937, 877335791, -263544657, 978945744, -49677273, 356000031, -938264242, -223839222, -815500044, 694677996, -858535486, -391787159, -130117059, 110528901, -424724263, 376453933, 262983192, -674556471, 856076379, -47794023, 271124058, 596788615, 806991016, 994249974, -631548196, 847621067, 163205147, 431903287, -823849900, -121788908, 700053478, 386938766, -801225263, -529281034, 520656593, 186158214, 740117844, 76486208, -439907610, -542868510, 316035918, -115635817, 893221310, 188038123, 609283880, -287931692, -373713358, 969349502, 404421244, -674707121, 957763697, 110943504, -469818492, -45380291, 341710078, -708832369, -816772101, -939395935, -368843389, -70185480, -859532708, 643842910, 800804576, 732726535, 944382583, 650936734, -351673701, 987772819, -462570581, 479614628, 470959000, -185714815, 488069179, 291754335, -33148587, 68413638, 634472238, -487595043, 570787784, -852269614, -232389876, 203147021, -272585555, 428420564, 190345181, 200790786, 343392842, -309999083, -795288119, -546566777, 446166391, 762222173, 162777205, -795664808, -987213729, -367472751, 469185854, -535034673, 988983301, 150478547, 566971564, 306848264, 725116366, -738226852, -58998947, -192367361, 268547574, -890297064, -262159078, 191308157, 75700970, 333133288, 817547437, -674585030, -952230069, 791980248, 155662535, 984629412, -408591596, 46127157, 837399417, 202371773, -774170877, -677207668, 663528373, -823423041, -861061817, 851975808, 19994922, -576515797, -378846449, -486158649, 735747631, -593629675, 137536117, 841698373, -605815725, 779511473, -653478646, -302257771, 872869771, 40782381, 852222808, -747668286, -578483733, 98544204, 637592560, -359578021, 258767418, -776181812, 909345624, 300579099, -868367534, 16444795, -590891067, 77865664, -716755580, 958226978, 649209790, 603283512, 208333134, 673845801, -860256300, -511675802, -595006026, 917037070, -192072414, -757399452, 509784069, -369890198, -374094557, 640010362, -259925825, -173346985, 908922044, 45224338, 942699704, 167488741, 641716265, 935566522, 642566419, -586552271, -333743239, -148897285, 633613123, -233153774, -253220117, -560322577, 865352637, 971527611, 212263850, 425782975, -607656624, 393833906, -142702853, 194384221, -587228567, 795296894, 185326655, 691905290, -639563873, 487050012, 812480152, -219253194, -326990718, -955858135, -715520831, 16411699, 137029700, 915107067, 389702456, -516212056, 620522548, -857060795, 256437359, 626978973, 959702988, 827625132, 136666862, 585573169, 498869865, -354235437, -815814280, -22901256, -824383439, -432808694, 286101651, -198170118, 480037298, -8208006, -194035554, -829731220, 953983931, -812698197, 408812546, 850204850, 787792440, -425367922, -43760984, 422245296, 519405917, 773617319, 498646135, 747880809, -945860060, -623062768, -982001971, 47647732, -409088078, -369626489, -470846586, 686754209, -479050763, -73298790, -78704387, 343052368, 427442599, -462825764, -156619070, -231162160, -62667367, 431604382, 591693621, 718729661, 893959550, -299995899, 660409513, 217676418, -342240667, 867243225, 631150713, -236461410, 759524898, 792199802, 82128343, -652629088, 242334342, -555738435, 195597133, -776518332, 151982454, 922538627, -346450148, 879977759, 37802151, -482402295, 784705145, -188551857, -3304965, 362420202, 621138351, -552155083, -196832047, -958990719, -685749161, 614112254, 233631889, -296320995, -137985948, 414339670, 963363906, 464500559, 374606981, 192106275, -113202241, -796435865, 950604468, -616036843, -189897365, 90206010, -860848076, -834106448, -767029009, -781922541, 595241481, -965793951, 245183234, -40393584, 500153987, 633053860, -253551834, 690639721, -274033597, -484708839, 426667961, -473838453, 605588926, 652680496, 493435204, 841806292, -65993236, 788651276, 591192452, 777520164, 773341709, 59522991, 601498610, -121616344, 955974929, 740920629, 615188641, -880528225, 312472453, 788368602, -647085367, -615388349, 958859067, 955699951, -626058628, -358338259, -783526282, 108143777, -238018247, -156001702, -799529539, -376102700, 944236771, 124040313, 501570706, 257274143, 124461009, 279686834, 441252439, 70556482, 615387411, 533694116, 526664150, 353550848, 341492462, -307752543, 571031851, 56257621, 617504102, 521831116, 467267492, -254443932, 571202904, 946936368, -553196507, -143964287, 707441220, 731459128, 614007847, -927439480, -240501447, 469726607, 637754849, -95545936, 751769842, -280378327, 395484152, 332957695, -313271408, -59655916, -336068065, -865070885, 613995030, -749658513, -457676904, 44523359, -688621598, -413109600, -583300342, 702886965, -831013158, -773962396, 103806624, 932945491, -209023161, 625189436, 722064686, 540783947, 129357133, 994616644, 320369885, 629170627, 512952766, -640949416, -161754280, 52584360, -779865932, 618891451, -35335397, -47314119, 634544203, -135672122, -19675960, -735780697, -460836863, 549389105, -429156182, 575169298, -356102327, -576299514, 965255525, 854216374, -86445497, 759772477, 355139055, 409279844, -469969210, 647636038, -128371462, 8196757, -753827941, -740724974, -613310099, -539262973, -965983565, 83201011, 379440340, -351146660, 100748394, 24180554, 745135659, 275252090, -521346274, -171887735, 138920056, -636554356, -976519436, 558721570, -264718140, 282496677, 202119200, -925345602, -805692477, -769655928, -947619853, 776822839, -843940117, 834927694, -302191500, -934583795, -208524457, -982724987, -488863173, -534383304, 375275571, 240003718, 798359830, 284133896, -838742764, -981046369, -636279673, 343915333, 16790481, 898306761, 320829739, -591912255, 860933784, 794079972, -914048115, 421017622, 690776188, 571849912, 291826227, -575730862, -865478209, 855608049, 103533124, 512163703, 243759023, -526030357, -224150038, 771461076, 298221304, -163984935, -791305249, 856016144, -284831448, 799777220, 332262262, 530718302, -782902898, 300722052, 273182244, -359151319, 41361766, -399706718, 741946607, 222951629, 927024628, -921174642, -759645627, -565740251, 40008007, -742464398, -936197998, 44659409, -240738404, 592514603, 586394291, -196390888, -455940740, -765625968, 861480205, -658855750, 412025269, 505532452, -71315553, -329843646, -859894683, -450535254, -250844068, 459622851, -169920122, 712556117, -359156862, -760385251, 142923035, -138986231, 915407459, -797729016, -56665377, -441441457, -132019903, -152947906, 10795477, -47987137, 613483736, 278459111, 880534390, 358419441, 331830890, -696749164, 331827739, 632408779, -831109444, -568713162, 688622790, 179921282, -71101430, 660404737, -409885904, 559606232, -432539164, -439000193, 273948808, 133217648, -396831109, -369954072, -859684389, 606825016, 259200196, 526984570, -924464931, -893102905, -31714463, 848432684, -945667126, 320447428, 626511572, 874000481, 147716433, -458323648, 793095473, -370192014, -214730136, -583868148, 873854520, 138934558, 658750677, 855986232, 312329312, 278396859, 735581967, 493839608, 973070651, -90634321, 710532936, -830457099, -838881071, -533604794, 315524627, -950485620, 20272423, -852699092, 346537029, 378880103, 843054932, 388635784, -310462724, 968720370, -98469345, -9822285, 974279362, 990785704, 326611777, -235562876, -184350209, 645762526, -530690551, -986827688, 52651093, -278820171, 426397735, -172986913, -511899304, 629157044, 597023144, -135009122, 158964735, -446178918, 280801040, -947972598, -431077998, 572536958, -499857660, -785856054, 131014181, 548953468, 303591590, 133492415, -428295867, -153035414, 833852305, -440119563, 545315703, -805085758, -717398263, 80125966, -558634562, -399317505, 120861402, 105113877, 626924239, 356972249, 338220588, 903306134, 206299260, 447733841, -65491801, -225357032, 396351843, -51813515, -298144019, -882362798, -296952019, 991940259, 58483323, 801124706, 953579831, -753632124, 107908011, 318861257, 801979636, -455494951, -704127434, -216105837, 486856539, -136850953, 657657997, 167471142, 199494920, -407106644, 216341615, -852211308, -599271486, -194839614, -474560209, -312390208, -54205393, -536833083, 486480294, 527401395, 461647178, 443097219, 231801972, -350111916, -280599620, -434453997, -254945662, 235469083, 185069899, -890523795, -593820534, 950042469, -709783867, -720407849, -61980816, -196617115, -582427658, -993103240, 553411435, -489107156, 647475333, 167526152, 461798095, 43770002, -634591665, 652260105, -32430100, 984078847, 812832482, -358351996, 396644585, -989951519, -160581850, 585360957, -489590884, 697312154, 689648923, -885558772, 468882511, -488997541, -349868212, -668873919, -21926689, -781386331, -829852590, -72057981, -334010822, 307660554, -110495705, 467791550, -349711138, 72427134, -469744827, 499068657, -226274925, -257596646, 76366684, 120536992, 390849869, -268076170, 238643242, -701878479, -481764984, -720302857, 489515689, 631828193, -189181288, -73008770, -876890475, 975761831, -214695832, 933356655, 432527233, -147104259, 544827546, 825979429, -415518332, 543677790, -706780664, 829366561, -814645023, 452247194, 197275246, -478572750, 340280392, 72819054, -237826741, -461082654, 867992366, -671764974, -319670032, 579175318, -781056896, 681541061, 323688550, 899707064, 773056134, 38705279, -186675339, 893461572, 433107412, 836743519, 755382686, -676596304, 816192742, 690369303, 495558973, 544327064, 928741435, -530165128, -36955123, -444949511, 632411097, -543423833, 885050769, -586141018, -281035768, 300248805, -315639667, -867862088, 321088632, -546688355, 684338933, -462217859, 717720975, -323397188, -455525847, -534884527, -825101254, -784577334, 469549252, 242679887, 138733456, 717655, 478135111, 506376214, 813907306, 565877997, -363953080, -189603858, 752050366, -108096506, 182037037, 942794520, 45774463, -621409688, 448865592, 978496800, 994684846, 131982568, 190660716, -587061529, -380311450, 462436897, 605539440, 86340094, -801348491, 278723071, -664803468, -920409929, -658374772, -577147396, -890345196, -216482841, -207235353, -780325956, 614201729, 435590751, -889803357, -893280921, 275622673, -941067898, 353225927, -609777653, -384800788, 913345239, -187017069, 599374381, 856819325, -361293855, -284687535, 232026338, -651250248, -116505145, 813768771, 960226365, -926324025, -2258451, 128476135, -460769525, 94013858, -930750472, 107113849, 650630846, 414042368, -887770469, 505752048, -982512230, -953448479, -507233231, -798610567, 882015856, -99693797, -863289757, -139542851, 661634439, -618668311, -718848089, -224265245, -13583428, -727994754, 189231228, 680870039, 687624479, 410259606, -999801424, -141199534, -430204278, -603936213, 58318686, -224358, 495345256, -336929186, 205803057, -477206926, 592107816, 965209404, 955515785, -11858602, 360367466, 130313730, 898994004, 326603711, -119712990, -614819934, -12752768, -202034986, 742479753, 193310318, -9352959, 60047094, 836935854, -397757330, -471996557, -55781842, -545618761, -656157560, 276022568, -267478142, 103501026, -513805790, -746743971, -275874940, 869109872, -959554320, 267083784, -604202610, -272612269, -898762633, 915048370, -589166115, -120323845, -175095772, 10564536, -571338486, 55785770, -336543589, -837074097, -118127931, 678226681, 876293306, -649627775, 881587807, -869831293, 530227074, 120813039, 448291062, -123647669, -236488838, -490432667, 972756168, -770584263, -174322407, 602495057, 34294781, 629846645, -468216660, -284308502, -258566111, -35300250, 439092640, 75794, -384243541, 836984160, -3830449, 677050774, -849753703, 443675867, -466111930, 945658302, 57128117, 997909432, -545694497, -484185394, -916227913, 363635297, 270309873, -694025221, 177022250, -278140476, -696652925, -859286516, 630228841, 589082507, -736151272, -747692145, 747809220, 121447574, 582141091, -236141913, -712073043, 990890856, -415276792, 434008126, -70443684, 722250482, 179793462, -532567223, 881044239, -512693200, 772936219, -599839639, 309132888, 6945791, 992761549, -136432681, 518614886, -703965705, -230136909, 955693177, 821704342, -132870756, -587136436, 89417760, -482418700, -989063103, 63905387, 746846160, -506760613, 787377803, 298056108, -890382665, -435425001, 771963453, -861466885, 667364672, 704367908, -636262780, -360513340, 94922020, -17828769, 779586989, -253487038, -848095128, -147938691, 215341301, 94308804, -971930212, -430856955, 965008903, -37531508, 601389046, 805567671, 63950754, -128333528, 300696018, -468640547, -313820096, 942709490, 110461365, -400040774, 558219574, -308683685, 456364718, -635917314, -756261253, 490228781, -491089105, 678762856, -546910941, -16752976, -63346316, 34176874, -32665538, -221886585, -246938130, -849629013, 91622814, 717626633, 896929259, 494937493, -926418947, 76957869, -453578527, 624829687, 122405306, 549936152, 118382972, -539537988, -722798418, 711322407, 482592511, 249066869, -740601810, 568917926, 818854832, 749153133, -954486441, -239646661, 995462451, -663866391, 534410454, 400886428, 17847759, -573096154, -956682719, 26259221, 843404404, -623305020, 447560525, -872179709, -324356374, -850794633, 370474428, -321077752, 89076245, 115773161, 677906805, -158857638, 318472367, -975878922, -376075056, -553930977, -345305695, 609038349, 694954681, -646223212, -961387815, -747377460, -866464555, -3554913, 90970135, 774512846, 443942051, 942740078, -667386427, 564283715, 873394420, 733269704, 100571112, 552546686, 282782808, 418883383, 923420804, -231323875, -935228800, -238619185, -90623457, 333158938, -137965325, -104747458, -149785141, 148470229, -521255558, -165098269, -667022355, 363065798, 469103254, 214120426, -248195598, -621037924, -962796215, -915140524, 827489395, -462204551, -613586186, -224475216, -130994860, 992410911, -461843547, 866827191, -196237900, 601216110, 131968956, 732943611, 296813901, -818783484, 485135807, 849709134, 126336031, 36978821, 933843552, -723797020, 440634986, -818065002, -322036796, -351867509, 889952880, 331838642, -362682092, 283091421, 553272263, -582877753, 45777810, -435735985, 811079307, -910630874, 401826233, 880615263, -836611303, 176955214, -404114182, -990761913, -30571486, 475617784, -734155348, -691584347, -204938251, -954320467, 349222154, 176282576, -187105185, 272815664, 975219051, 968032480, 983781619, 16037216, 247777362, -864239124, -901561495, -379205891, 810289731, 922978759, 604440422, 213093905, 554252559, 845155115, -590120198, 448881787, -952350854, -418139567, 820109497, -705033976, -309089252, -284218127, -383778233, 171956111, 651401490, 198531422, -771329655, -461928328, -819617139, 833363530, 32242676, -8462885, -697175842, 857622841, 595867576, 716806463, 892785956, -440723935, 845710763, 352174085, -138996128, 135093255, 800997132, 199412898, -930509394, -426821856, 551650460, 850024846, -741251708, -263200153, -774873576, 134989740, -849097784, -683816781, 555994986, 113923526, 114598459, -585696604, -862528675, -699630643, -839607388, 450359464, 805329543, 927326149, -252570429, -869909277, 42378671, 783584784, -188611352, 221563932, 651226402, -652412745, -358124568, 103365129, -446767478, 799095943, 324645564, -909259789, 612152325, -308696628, 330528263, -694540142, 979597069, 40167082, -762695543, 17372870, -887149608, -482018895, 930345648, -526596054, -963505478, -880187804, -326665775, -682463308, 193961470, 480209651, -427467056, -498250449, -816688407, -386693625, 932641293, -504506526, 810848816, 114567077, -421163313, 285234201, -975912737, 589857674, -838489573, 171625659, -553215882, 5825709, 990112125, -155436821, -484975480, -759949605, 526571993, 836795890, 594708408, -186925822, -457105141, -539209340, -486412744, -652282248, 367501483, -605610540, 320757027, -1945515, 606327004, 241704238, -664869912, 133297898, -835148477, 859153542, -579154669, 675404214, -932193440, -143046767, -121253864, -923402867, -701768329, 303971416, -269794066, -270571253, -655436301, 517356428, -801034619, -384279766, 105625860, -967350425, -136523137, -832032002, 598412759, 635195860, -325875979, 514684783, -633817749, -133002634, 580296513, -840106602, -4143525, 395042474, -31751884, 150233024, 887812444, 593494467, 47992262, -510091327, -509790527, 534659423, 996859631, -982972292, 212515805, 772021598, -513722524, 464116754, 267237942, 861658515, -979262151, -853457924, 409316739, -611765244, 107520594, -311796175, -681326725, 629388145, 648229207, 482975355, -997121272, 389940085, -309742120, 733526836, -563331032, -368978471, -218994514, 639712504, -311922032, 871630187, -503376430, 991821777, 287363486, 917842673, -501126794, -353854051, -811899624, -728819297, -586819555, -941180140, 129838833, 219078937, -751221001, 796420712, 998937205, 765704128, 771544934, 217626677, 447420635, -494461141, -880707449, 236700409, 788551518, 361129333, 138503013, -154489729, -349879409, -157753977, -303298155, -419094075, 893591102, 105713879, 605204805, -764696873, -866335792, -291932381, 323014086, -988878047, -949227360, -121565731, -859291578, -975579257, 379825641, -557516456, 119530990, 625587875, 269906988, 844016480, -949904426, -696360814, 133473630, 610314124, -198266892, 315709985, 676782228, -665767579, 966193546, -444082287, -68715956, 958029336, 568011752, -252736499, -799791270, 141209800, -49134399, -513668121, -563792041, -793587694, 302880384, -559443343, 500222277, 601394720, 692770684, -523618320, 728002815, -619365804, -107673017, 663704456, -219144111, 248880450, -585321925, 79279885, 974371148, -911641756, -230060772, 968225257, 258838644, 459127577, -33303406, -194905553, 63340465, -394829269, -393806416, 469839907, -457765892, -831751617, -94489520, -99480296, 800345424, 833549533, -708974560, 473891736, -887140534, 285225696, 9662672, -617746178, 129182936, 258845875, -94219181, 368634096, 492022417, -330320707, 351655713, -253534123, 143853222, -184288688, 89337530, 151542412, 781802002, 671038281, 173878298, -647089394, 896441504, -446489805, 648607103, -609166055, -318838195, -51908900, 100011161, -755595396, 86120150, -20736125, -396515821, -716457779, -697160280, 399861297, -372018395, -737476324, -585012856, -983898645, -150710555, -925468466, 269306132, -964600084, 971599061, -927968706, 306878036, 564963751, -44621959, 688501221, 138526448, 793080190, 772693599, 180585773, -519503035, 406994487, 448735186, -335320582, 208814276, 252763696, -620964720, 778185829, 58095040, -383203894, 360556228, -464623571, 951325768, 863071977, 559487732, 693548725, 405469064, 957451829, -874265194, 884506272, 661893208, -453932769, 174828023, -38414266, 342957848, 988155726, 635520564, 900175781, 78370680, -280878197, -683050117, 715683598, 389617615, -120430474, 348274702, 992107671, 268887091, -195349547, 816387967, -630678515, 782960377, 711518365, 250372360, -217834145, -76525826, 820394170, 359550414, 52340113, 696580149, -812865951, -913969230, 270171313, 59988354, -829933929, 834113280, -334406544, 51227696, 395928060, 414595997, 581277291, 481784414, 618734367, -458068848, -485911866, -243945578, -970119031, 60894151, -122243316, -116109677, -691961605, -635873896, -633365020, -910285709, -464536547, 998147752, 917089469, 780808422, 573269111, -83074218, 702560704, -579616289, -588175851, -326879451, -53021636, -48192240, 574083435, 923980120, -723482555, 615526118, 149309243, -22207210, 158995167, 890280401, 240358212, -633641828, 485166363, 444952567, -157959177, 499491170, -901635498, 980283387, -463442783, 378844843, -34826589, -327035374, 406197717, -318153023, 584645487, 233704949, 886850364, -402216190, -219314625, 79053437, 210528883, -152441261, -995213436, 272004024, -848855838, 250364889, -589654404, -210281577, 322093728, -954221229, 634594938, -266789151, -411793350, -813222886, -40755736, -153668329, -490468355, 262988676, -133714031, -765760483, 775725884, 761557528, -198773246, 890521132, 324451613, -847177599, -472841808, 89704662, 604069953, 212422980, -408960236, 915200582, 241950153, 281941239, -273611295, -461557902, 416735733, -980479673, -956454321, 513520688, 186806656, -238059752, 119580288, 632079416, -465022684, 288765506, -620636892, 133596788, 229709760, 23586462, -984588289, -323995607, -847945551, 617376362, -622339480, 783017215, 247681635, -579885046, -316826847, -153523748, -986445205, -875966335, 600150348, 812588784, -834929048, -358424252, -594762460, 700746295, -67593997, -433236474, 988634971, -441402049, -691653739, -985494946, -953073647, -688300529, -381681384, 783035950, 760010949, -520212620, -764162175, -240947834, -754481844, 622904795, 835573617, 485529430, -270754338, 8023391, 507940922, 882754823, 287397677, 113557958, -229044963, -691663312, 94039891, -443000203, 452129869, -477572059, 170827233, 36662199, -580165049, 641034170, -558285920, 223750988, -203196145, 177160706, 403168329, 605462206, -943970278, -477588429, -247203184, 481337513, -952604819, -268890634, -463632882, -40906486, -864577435, 385102257, 594518443, 676017463, 176449075, 165893063, -397685068, -66659608, -755015965, 200565462, -417686827, -746019877, -213363403, 328906052, 546507123, 912442780, 104587149, -614657207, 376336054, -936333885, -917826583, -607154218, 539429123, 41776917, -522419847, -545020226, -927098079, 543932644, -129981852, -529947126, -940920383, 439960053, 262582823, 361670261, 571324918, 560123653, 718228258, 407118889, 985177271, -67105366, -967086745, -492077287, -535755777, -718623991, 288289810, 631624338, 769441674, -431578031, 822407640, -357302804, -538875048, 900214596, -48624368, 480988869, -722473617, 674300698, 39943219, 87171356, 881654316, 702026070, 761152826, 184489191, 82024994, -994864180, 227099430, 768348507, -618866827, 630557990, 644536088, 725916204, -444852959, -450700449, -993372039, 330811006, -97663161, -259920085, -883606449, -174149187, -864046942, -402483180, 218009386, 762575462, 403681141, 855991703, -705472154, -923261263, -32532429, -731673405, 115289922, -155689545, 560461350, -140356624, -974576896, 949354120, 901548083, -314472132, 258183124, -164987423, 463525035, 647306405, 283481539, -511599615, 985730548, -558172059, -511791983, -116190204, -569822902, -428149142, 43009941, 680245808, 605222283, -903898998, 830945165, -770563787, -69125900, -158342339, -739211783, -848191699, -343366676, -136876532, 190861215, -633591555, -77134123, 618533128, 973688251, 762269855, 446167914, -626585847, 213890248, -600591967, 934767438, -918892407, -569504195, -121423854, -28669403, -796383764, -654467449, 435074223, -923013114, -908112274, -226925923, 902508756, 987949101, 172661444, -824896550, 616264307, -122327449, 590440030, 715948199, -838440490, -746289787, 685779837, 846554756, -435572982, 889906477, 713592638, 436535645, -523646556, -221523029, 973262751, -507566637, -14331202, 650595303, 294841391, -522993869, 854490912, -641378413, -654103797, -731103188, 17851181, 777216625, 497477374, -735930094, -24560396, -843062931, 222611543, -270441033, -972090818, -156595383, -46056614, 533004261, -685775118, -445956854, 134273009, -654482131, 602511121, 642837816, 591105544, -277795307, -151830421, -119337372, 986112038, 62932384, 583449911, 971283801, 959274826, 927393892, -485207205, -110883110, -597439492, -69886230, -150936899, -541739218, 389246181, -204370129, 838349171, -750888279, 649991365, -825965526, -977062645, -55961584, -958098417, -632037334, -666330392, 403031605, -812363023, 400271587, 217795596, -225653256, 747540687, 76168825, -127685633, 752737939, -19585511, -178801482, 992808432, 86313533, -330127472, 884978043, -187613112, -508593213, -362888264, -702557267, 917922197, 190874406, 36611893, -921759586, -548619789, -408947976, -521370741, 654223973, 662316872, -903961610, 83984776, -44927174, 656589104, 152327701, -895821387, 641529603, -946941585, -204637675, 525864441, -907608473, -882483493, -212404253, -408559521, -325125074, 221596624, 759547197, 227798351, 419927522, -857137540, 250717831, 389833141, 952874038, 507081944, -942034441, -492108700, -778888026, -554976302, -374191063, 10102888, -880799123, 317365626, -719507837, -730400640, -889358708, -980041233, 979414324, -910466932, -881422970, 810993928, 54596228, -937100656, 838760175, -946289960, -347442972, 361533972, -818955860, -617958013, -145988960, 785520301, -541218799, 57202219, 367760381, 685245485, 947240972, 931027165, 930484918, 730910732, -1891448, 307400112, 95179385, -242780846, -940046174, 716236724, -91482316, -55634283, -21049579, 657703990, 684844644, -227660970, -140280839, 525937335, -778194595, -275394654, -886574740, -865870234, -851965685, -119818742, -182677492, 578224955, 56619090, -491984011, -671126000, 328048767, -357704710, -624049835, 503025395, -700446228, -555522847, 882233429, -73143483, -82385321, 836262532, 339936455, -254721168, -382363993, 848263096, 595279144, 907316821, 487597810, 696121, 416217940, -554169663, -355940503, 606380605, -668575808, 353650269, 640146177, 991128924, 619501515, 206923744, -380404202, 787470394, 691270942, -334634387, -566633475, 794798957, -697635241, 529365960, -554721916, 724511472, 502784335, -331867389, 409693182, -959605090, -232948040, -635388196, 418079654, -137863189, -674187953, -327470390, 493619535, -217772103, 606979058, 24221707, 554855371, 562574107, 631882910, -169465244, -952561575, 304185249, 157756865, 35282512, 644326709, 143375415, -118900802, -625196787, -813581926, 56700869, 129145309, 893556340, -837199600, 227500854, 556129462, -331315182, -206856675, -770582123, -574595776, -484122902, -942698563, -348409785, -714545378, -860585214, 531907231, -288593681, 113464413, -228887433, -109038855, -367327532, -675574604, -348523764, -845229929, -41502329, 98146558, -690190373, -555643983, 610472567, -248759316, 41010543, 217546375, 496584676, -863360784, 392683366, -412040220, 311309517, 363579539, -244023811, -521029899, 164828655, 803660287, -166629904, -105287109, -534708660, 681034337, 546258856, -749512429, 803760998, -305923547, 523161655, -139053094, -590819189, 61326479, -881840792, 934223528, -372110825, -319686898, 619173161, 817890845, -72859671, -436131657, -496623026, 188302595, -333761867, 441460601, -951525182, -656813732, 804903408, 167717138, -682407195, -413369013, -1362469, 460541361, 14930869, 429220484, 961267396, 214501134, -285835350, 36812382, 114243383, -271093948, 234673317, 194994866, -682164768, -361141068, 817157121, -952416404, -344561859, 767618426, -233273568, -92926109, 659488422, 966273420, -674899965, -741562147, -831593246, 36871762, -374633456, -934236148, -974995316, -867169166, 961720760, 812106212, 416082813, -105425505, -452090159, -764965947, 781343190, -481143807, -600560966, -722742104, 64461805, 613499384, 282734100, 189320914, -641346025, -910820039, -211766400, 162847222, -747314932, 225989680, 816930338, -64557529, -685165438, 499331730, 134353127, -805185758, -784897932, -243692274, -522652726, 990952347, -745170441, -393184133, -82071739, -221042923, -601614565, 594561783, 305281444, 24291, -844691180, 779790725, -753245722, 230297680, 801200299, -80263252, -95087006, -194490529, 853664675, 573337230, 14944040, 143985665, 394602606, 594813597, -788818285, -103331029, 908892884, -773076272, -17876483, -497021246, 136569758, -952800217, 298982247, 54883956, 790720968, 708463378, -623637514, 231370620, 869002072, -168580514, 836142694, -857720062, 571545451, -645082576, -647734595, 145201404, -117048000, -541596221, 431996204, 431712294, -225813254, -475348050, -575632844, 376105433, -869392203, 817732788, 854956303, -920697818, 497135801, -610337777, -805398750, -605363149, -867983120, -413353661, 827732894, 329907462, -496150239, -916766649, 41581532, -727982193, 712380063, 6087880, -790908675, -606892161, 369927560, 691328135, 248779588, 594171544, 387080541, -618764431, 123387154, -814869974, 233393095, 900166554, 772275883, 571660469, -20583557, 885205755, 928951709, -213028480, -456236017, 971956862, 902410765, -947813093, -83326163, 674798982, -878314287, -380782307, -39167955, -790415229, -446187552, 142227742, 504665161, 348472666, 375557624, 562552333, 182550767, 762172236, -649131246, -746266632, 160101071, 602315398, 671434274, 5219132, -550189450, -124933537, -818577560, -668078078, 621799607, -390476457, -421545415, 820935404, -695270149, 29331911, 85473360, 729573522, -67577435, 861589298, -604668149, 681394714, -983550426, -107149793, 879749410, 939029973, -856185562, -351168434, -257988304, 534377690, -669376557, 141514390, -394626241, 970500046, 174511274, 597382002, 99732037, 133892669, -485041888, 521676117, -42253385, -195492118, -281321487, 742819, -884462746, 825306084, -990322751, -285843261, -966308622, 537424150, 705260192, -825281920, 135226403, -727366205, -331598300, 545954313, 301110884, 496255759, 748899063, 368842179, -772434392, 776687354, 306678580, -749338829, -944458850, -665165570, 224810357, 751117009, -961847869, 513920975, -164071298, -121089594, -483830356, -673509539, -546014796, 199103466, -598351525, -929321103, -505511006, -863276400, 104985040, -80238697, -776642347, -746736530, -575980763, 239265570, -572020188, 509666926, -495473582, -255407894, -302685322, 105814474, -679217952, 638394145, 953833812, 249393034, 534651208, 674739282, 918632945, -741821916, -709575239, 604777382, -318970213, 521696399, 812208095, -953000704, -383299239, 744126108, 797770559, -726702173, 763548895, 284506735, 441836104, 701183533, -742784710, 841625371, -94034255, 779847765, 887224508, -831366188, -171532950, -571461619, 661103166, -664255105, 341909224, 190764464, 382652099, -432803838, -436328400, 634149192, 989280057, 702142096, 882948138, 952444109, -356677804, -995713402, -729424361, 457928009, 685569723, -148990054, 221531698, -979274857, -287071291, 492525273, -944122933, -308128782, 574234338, 285287350, -502653891, -895563732, -212052962, 146341958, -207149664, -358911880, 337154906, -949540875, -177453060, 964632383, -615915611, -62109059, 589262848, 307085148, -474461328, -802613549, -579714240, 379049665, 22548784, -224256783, -244954526, 285642475, -186507034, 224080643, -259612846, -386073328, 212323184, -189227923, -717756679, 229472095, 198264155, 305161027, -24907045, -819185736, 931021479, 555876760, 838480787, -400625380, 584969776, -115755046, -252160941, -527563896, 840261289, 902388245, 770060108, 961053279, 586260804, 803901802, 318287855, -925873683, -447171657, -173776589, -979538064, -960111776, 300537781, -90106657, -202238039, -436244933, 648320092, 870093399, -213758991, -751189185, 223582278, -895344257, -241526852, -898497290, -788561644, -549762005, -158498469, 110991952, -285829661, -452254892, 919589794, 114683489, 577503752, -881220935, -957045591, 974397239, 886019804, 453322164, -344573375, 401517498, 349983674, -214276136, -421867160, -170151277, -813835342, 965970297, 637327278, -102113539, 78334951, -614862428, -347210762, -13337595, -399505615, -941501412, 115347477, -33089048, 763269410, -699493644, 186720280, -507022676, -158821873, -403199423, -824260937, 201361353, 220625655, -741713532, 114580258, 624402276, -430253757, -880710308, -531339405, -469424196, 92733116, 937918716, -15780078, -82687329, 369299455, -141109559, -767458970, 242888955, 556317254, 436255470, -660432737, 5219612, -897947963, -290973081, 294503587, 956908414, 623549565, -154687849, -181457589, -105943174, -755553465, 973036831, -931090189, 599309254, -786961849, 135310919, 177763125, -466326788, 600782701, -405490635, -506612440, 700814731, -616635928, -406847842, 386293326, -925713989, 468536101, 870324961, 527719759, 159338679, -87027252, -900870462, 636861869, 88502704, 605415821, -665019193, -337718343, -784473227, 947850876, 599814971, 330152285, 198921052, -739147983, 93788263, 4109820, -925854225, 962198079, 220646256, -948138570, -273232183, 262825985, 592703300, 263295322, -244181110, 266404573, 704881883, 838290418, -283757347, 625868147, -452441299, -243000281, 641815282, -663596779, 374866089, -357854344, -869333841, 870251771, 711681477, -172798524, -487907839, -653202725, 437021303, 816087520, 923049490, -312253059, -306034515, 437572905, 684429425, 376468784, -561866374, 286875925, -816814809, -366907858, 255821874, 746104884, 633472589, -6636275, -753248015, -447283561, 780871369, 206618226, -348441774, 320487895, 197823261, -851849089, -638057175, -349344865, -640164361, 529389755, -867561609, -724100911, -825785560, 866122399, 962388256, 577797117, -491710460, -203883282, 367199257, -282566455, 11007171, -400889360, 731790354, -484471409, -965352824, -531457256, -799893077, 956417772, -345713514, -839988860, 695885855, 240889647, -655252648, 745709829, 64292404, 250186649, -814748686, 594359466, 450040571, -210975063, -393190594, 861220006, 647709499, -906152563, 185620299, -225091160, 502624974, 854538368, 376729446, -691659230, 615816960, -960641779, -815581177, 219272838, -155052442, -295257015, -478269495, -290327524, -202516726, -718811991, -699039188, -205622605, 421025487, 962981162, 695245224, -878237133, 479611975, 818334628, -971486885, 944367402, -284422013, -999397245, 725579606, 528088096, -413253939, 419748755, -452703735, -248234157, -789818117, -618077982, 216302393, -319053092, 836143069, -946186093, -562851043, -352277332, 441542105, -433657822, -83147390, -457017619, -305034013, -383638863, -331060852, 321348173, -519274436, 382100076, 659085257, -314345440, -512446386, -575225243, 122789393, 270305231, -190807212, -745386140, -901039058, -216861566, -467017722, -382622655, 818435863, 946459339, -600000626, -495191415, 804316519, 859224862, 637005875, -600037739, -710004885, 401751100, 414553500, -100950976, -8447802, -224286175, -25972072, -856895569, -390108034, 611869045, -597782088, -789892968, -819730154, -911346379, 916153913, -971485921, -157350308, -234759558, 875706409, -496497343, -129408841, 631435697, 750312442, 695340302, -717864588, 399794745, 67945823, 416040639, -39243027, -501038458, 491118695, 287397446, 499988559, 39759088, 63502947, -53915914, -504496580, 781528007, 245374235, 713034532, -688717006, 157125877, 455965934, 527044754, -17868782, -5800673, -364853634, 90121227, -784481125, -207694673, 866323029, 657367613, -677340411, -661979057, -846852148, -513808352, 237633704, -486758275, 711845245, 624198228, 542856378, 447695923, -588758533, -837184751, 274396172, -164260717, -339838981, -577784114, 887082029, -918912456, -15427173, 477104456, 490403598, -866087834, 168505795, -564320382, -390158502, -31604004, 574270430, 5865505, -729973867, -486409474, 409645075, -455480223, 475328740, 712235270, -461406249, 758905622, 473748286, 81680894, -905559609, 73135820, 492555090, 305162305, 960294438, 160077627, -39611148, -885346793, 138942677, -737266232, 347247564, 494488908, 392035911, -696088977, -545177114, 408761338, 527310186, -661885104, -681052626, 57853014, 208641468, -302107675, 843450097, 475143867, -218117961, 229245314, 206819876, 602412625, -319848290, -765346724, 535435619, -84449914, -103214452, -138339500, -819956432, 544134593, -295074707, -453052144, -467012583, 892655598, -835969828, 209323360, 231186759, -723194168, -872744250, -324389737, -58052376, 12773080, -539742432, 904389330, 222248174, 260134076, 256344891, 676617405, -878844954, -819440882, -605330965, 210259267, -797691616, 895676421, -104878790, -317657316, 798501845, 996461933, -3356636, -798587210, 675820722, -460644856, -574340365, 932655359, -901670691, 85344873, -226658006, 544982096, -589156121, -542709162, 726705265, -436627066, -855652171, -65931182, -523928248, -16533685, 194538969, -427656494, 255441720, 723363961, 103642506, 213260453, 861742978, -952173209, 562569348, -593447432, -980872146, -689333433, 40223397, 589813114, -170564832, 281149059, -945461727, -803450051, -920543004, -436073938, 72661115, 602490031, 488633028, -340192638, 745502681, 116519600, -257378937, -924201011, -520384312, 164806989, -636808937, 225683904, 434469735, -348847863, -749789079, 417252234, 734020348, -948336806, -710532305, -787450625, -383184224, 918328732, -980975484, -646268466, 665497952, 386166497, 630984342, 292852578, 114554349, 314850712, 456144198, 449125584, -880421986, -972885868, -948891319, 685122848, 347571248, -846427936, -416753824, 689021034, 787617133, -904474622, -727687421, 631998465, 673982069, 308418505, -179527019, -743694784, 371261884, -572338395, -646128609, 896178775, 765138933, -302023763, -641682358, 601024322, 927553506, 355488180, 34244737, -229129638, 567149592, 87945723, -326235419, 111302249, 310917047, -743163865, 763543074, 489323606, 642931476, 353905989, 892762650, 751647627, -546071997, -23986159, -439411336, -527787296, 942250353, -264575122, -884361082, 552945173, -122332298, -38437680, -623373107, -334473305, -716541932, 507947298, -937128738, 755836469, -101348183, -320829734, 532698883, 835469336, 758284677, -465119901, 999530532, -138916201, -240175516, -422545000, -987703454, -974828108, 586493692, -328866827, 497791663, 198453099, -224194869, -283674611, -661497257, -365537563, -926128436, 580702073, -665708062, -909943803, 7128492, 321281412, -671821508, -441911053, 472399565, 287173137, 570992334, 916209625, 285806289, -569306992, 230391204, -357619895, 648761372, -130701677, -360925598, -579239064, 112931075, 263910911, -905711840, -235718046, 230054978, -745703159, 197896618, 982610471, 595917715, 910628553, -627763371, -644118595, 877360217, 921710509, -937652999, -415611382, -452471443, 66368848, -894330362, -926053791, 922007893, 21500269, -155513056, 354349574, -904004760, -543822461, 823417375, 180540427, 689807546, 909031647, 168224938, -505137521, 619411826, -416632817, 320808787, -454417355, -456463518, -446805448, -735770295, -430571786, 30349271, 151949508, 854042603, 102392278, -763380876, -596952204, -394962724, -100276069, 721721309, -674014521, 28252121, -799336659, -378078920, 117028119, -864254072, 136577622, 411531251, -387884628, -821273667, -450621180, 800716411, 466229944, -402406239, 259528630, 310308287, -921559855, 786878584, 918953876, -260805380, -676865262, 236498118, -806176203, -478590823, 766685406, -775886471, 656915700, -711276578, 284305987, 805239352, -386576262, -207104226, -735424357, -294885561, 677637864, 964951274, -365676372, -426606848, 46881060, 928253487, -288364007, 392391695, -916867320, -327031235, 886664291, -751762847, 496246442, -195849719, 113017292, -396369265, -712293172, -77510212, -400447914, -395890601, -438531988, -502423677, 483536649, -66062966, 646919310, -1268189, -297799080, 622372551, 82290064, 100718246, 316584985, -511771335, -889131421, -638533084, 29218604, -632218611, 137625840, 402003075, -260034127, -442229826, 866929881, 78265699, -713853578, -351074016, -747454953, -468151207, -248452527, 908422924, -880915464, 711519215, 104194990, 801278268, 745150557, -398047629, 229008402, 566091054, 429002350, -542461929, 341859644, -995331018, 515015759, 124655473, -749804350, 611606261, -888867936, -528759795, 57537083, -580262631, 991299272, -588258706, 131820615, 578076495, -42763002, -782602589, -460201834, -299670424, 169492584, -744884608, 610089592, -663293762, 489715973, -462208875, -688568448, 961961353, -851309364, 361521799, 500082237, -756035438, 864417655, -462689348, 251795965, -651599448, 416936093, 663361716, 698431523, -20627010, 720292693, 872801150, 450153017, -689974840, -548109731, -827719237, -113528642, -751237706, 937795273, -156902563, -23012452, -519716797, 227878227, -218116654, 248926082, -654550824, -776730126, 398723211, -966183103, 815234761, -661625029, -34558959, 640201718, -839562339, -781270432, -975311674, 518356862, 695426813, -160906575, -525975984, 442073841, -27772047, -928108007, -259790496, 316986831, 201566817, -926612125, -283674131, -873348194, 904647531, 623652007, 395145622, -542261079, -523565744, -802036717, -507260223, 236440800, 932838454, -780188038, -531841384, 295844363, 763344133, 907326572, 546367008, -969263662, -191267055, 954662746, -272313379, -396877871, 944453457, -764809645, 567573762, 532103568, 765411656, -541014627, 624085113, -566209132, 911961922, 545261638, -763137147, 110515489, 837315402, 918209495, -290040837, -609165696, 865167345, 682390067, 206611565, -935188704, -427161260, -107112298, 43000465, -320429112, -557654387, 58363112, 172023624, 612276587, 808078424, -246195901, -287694827, 779604170, 962231009, -480568227, -708505048, -308433307, -876770828, 852099734, -407039395, 452894104, 575698019, -723618266, 154738563, -767313809, 198849335, 715461787, 565490567, 898636344, 434399682, 9686599, 308639490, 503211171, 230340890, 498156059, 981493743, 445174116, -696814328, 706523404, -736423393, -260268773, 334533392, 85532294, 567379630, -281093911, -635074825, 921704393, -805272282, 594696576, -589662499, 270029563, -805751747, 143901736, 828836604, -949667668, -567448055, -658807127, -774561837, -41239195, -878297519, -164803405, -364903464, 17453999, 303075785, 145994949, 330747829, 1996269, -303157953, 542196177, 718516186, -95539769, -362301623, 508761695, -474613697, 326062079, -92377261, 327261084, 89277808, 563747045, -951529976, -844674548, 552380673, -482002140, -994048132, -3685207, 129483180, -722811809, 554825608, -722343653, -407703223, -228478317, -294467877, 634268347, 101636710, 100348679, 106541621, 209963741, -6031525, -297481163, -421476213, 847859822, 11560996, 853881626, -876811155, 545175438, -757364678, -957781784, 928061960, 29432988, -894644976, 792362639, -334100541, 335453702, -383368241, 323869860, -972980446, -474470170, -245122377, -10668258, -269348641, 827543766, 150843942, 924749732, 59172453, -834199015, -341658890, -566967668, -756557233, -708857417, 444060154, -716304739, 822639261, -579831183, 408429662, -652794170, -942264474, 321075907, 624679360, -212156951, -162939462, 294200816, 205219540, 465062153, 917080513, 577920907, -13973162, 73709285, -789487052, -812525260, -629641938, 926672400, 355478019, -227972808, -459107934, -735124401, 854979261, 328518743, 736194284, 984862383, -315741234, 939807859, -32489553, 314786803, -894932464, 593515884, 874448255, -629167302, 137532128, -923812883, 784180910, -779596385, -425249943, -845135631, 996674997, -681853080, 982684187, 428634039, 900522370, 291286266, -532258585, -261927887, -598883068, -146017709, -90202545, 269526434, 29424537, 205370522, 344293790, -837245662, 36193889, 869293168, -815443616, -33693313, 124381370, -351576919, -957153694, 327483658, 521533984, 190830997, -805779971, -370223912, 817436012, -26784296, -755301739, 679779107, -361787333, -805730277, 8888500, 716068523, -638333523, -773536409, -791211610, -977878597, -428915418, 971271103, 578851670, -132938815, 547082202, 257448149, 318682033, 764271524, -989027498, -762530852, 587198789, -374205739, -180391365, 258433613, -338805113, 209421671, -576490122, -863904740, -918718151, 24926119, 795353283, 772856560, 375193223, 870743359, 367792722, -740763532, 489522577, 85872944, 416633869, 521374864, -263208168, 663678990, 104729764, -105869600, 330484963, -71077859, -14388639, -859783795, -317755690, 501900985, -185561425, -318587949, 729273970, -435958353, 823388863, 812188771, 581042488, -777867942, 990008314, 902449287, -232538693, -20534647, 605549522, -429631041, 93961280, 370302062, 734114716, -479683878, 174497918, 483795960, 390844433, 514235721, 212541624, -718472170, 843307429, -408766937, -122804897, 442193844, 168988828, 525418590, -220659613, -162302966, 245978942, -306728280, -955629885, -284700933, -519327319, -449324833, -875736208, -946654532, -460871592, -830568459, -236609640, 685851953, -544174352, 481533465, 421394159, 142144560, 135168727, -580193795, 858631785, 169024420, -364280817, 16181911, -635007382, -55228826, -19679419, -66328622, -104203293, 359741558, 99370822, -398785272, 685043704, -921555090, 120093944, -801686092, 282668404, 550795257, -19399945, -128026432, 150463199, 609618894, 712339617, 26725691, -608780386, 336610903, 188828390, 141118793, 603337492, 816308936, 826171200, -907189434, -691389713, -83023655, -565394079, 136915017, 667509261, -488802220, 327196944, -371816818, -973981657, 617604620, -174312685, -533895982, -466766860, -681476012, 578381476, 313240749, -271186235, -701371734, -386437975, -101526382, 677640960, 655795995, 630180012, 299311589, -953235121, -924309989, 405710228, 202625050, -108654473, -882325099, -564986498, 594817469, -712328031, 810473667, -507408094, 669731951, 528502301, 36685377, 876412678, 763963744, -467990679, 523947961, 948238517, 675140714, -424173220, -215619043, -43771392, -749895550, 306352834, -872261120, -674935096, 775142084, -541274792, -310837461, 721169222, -429234023, -469920561, 166859733, 426831792, -960585526, -535241980, 39591256, 195120142, 10275117, 326394203, -898165060, -371178537, 288334517, -792861803, 290421546, -692048699, 142683455, -92251706, -353315284, 739698883, 487493634, 531543641, -708185549, -360264389, 217108918, -647588200, 90006557, 880732113, 694823657, 507949199, 885088312, 524777662, 76892497, 557249856, 842647191, 928551449, 125122452, 466550383, -644438402, 402780717, 659083680, -374132619, 696181961, 158993753, -692251289, -358649509, 760744374, -396551730, -779955908, 223707353, 351977163, 762410594, 653318311, -750326261, -66913868, -689619698, -769254544, -153348055, -990662278, -815491464, 755981270, -43025351, 513958878, 489132836, 493845650, -791599725, -226727398, 88411646, -64519174, 427357822, -95796788, 937662437, -338909976, 793070626, -826491145, -702590361, 498517103, 176220022, 631657875, -783056085, 263100630, 917204683, 4657038, 636900839, -452578582, 696009822, -896157519, 180914573, 197603353, -822968516, -415870890, 301359146, -431962237, 846164360, -622520975, 661940296, -155148501, -214396463, 380889995, -81876259, -613284203, 72052291, -821589838, 952373149, 768324802, 197338436, 145886949, 254259423, 40150804, 503557000, -213527979, 190956370, 777136053, -148031952, 557154103, 985729720, -453436354, -991680753, 591707597, 346696205, 196044023, 159473374, -488003056, 233726149, -167924411, 531519764, 441313698, -46861747, -867111369, -440025119, -92964013, 71511525, -309674839, -49807082, 170749004, 2947137, 816546915, -357833034, 836496670, 124791131, -165329705, 493778395, -820071653, -664301588, 634341308, 389714640, 164997457, -492076633, 932988358, -443786494, -210204573, 994026389, 691551951, -397044346, -679913959, 405119236, 826654866, 558215966, -994241509, 490951793, -385231910, 383731003, -543333837, -35743103, -441918076, -615297361, 73806029, -537308522, -242573396, 924071216, -216531958, -11191136, -186543263, 617800538, -729158898, 279342305, -186147684, 714921412, 538757271, 677522183, -957951116, 263545831, -680334146, -326073531, 357525419, 317498299, 943090776, 689635568, 51114121, 922072284, 237443819, 119686958, 631438084, -727345884, 932387559, 75652648, 702649145, 238073023, 594320200, 118719419, -913178591, -832110485, 159903970, -200791785, -611283643, 820784903, 607662319, 124102170, 982443097, -319444699, 627879884, 713006402, 2031641, 166998163, -669648657, -289574078, 640765522, 998215036, -316975638, 416430275, 519483849, -325923094, 659400097, 888987018, 171065192, -191319462, 674771360, -387989327, -496554833, 397356902, -304686384, -37612205, -356380231, 983046123, 276293627, -429006095, -863829703, -884694829, -367220187, 42566851, -620711516, -832417451, 373585767, 111987175, 128255192, 827051608, 594987320, 30891956, 31952858, 644616722, 324219525, -468708499, -880995710, -854081293, -296744575, 84884874, 82075114, 457024271, -903185209, -612855612, -716009629, -725008837, 373041517, 675729044, -5306161, -810735942, 712479408, 137898023, 139834145, -26292638, 834352285, -773269552, 299528450, -438730833, -610777361, -721771861, 941943335, 379893560, 237196949, -877306620, -872540795, -725044095, -21541650, -41641242, 863192563, 121332521, -886658782, -450501717, -966673443, 317259728, 863870224, 50117029, 647373715, 711522707, -540928698, -92494797, -524080954, -243514186, 428605953, -729964674, 113013571, 236471496, 906890498, 463894424, -518119756, 358629554, 825121639, -386461142, -2124366, -546967993, 259475729, -929316687, 180217268, -19598683, -570307298, -113076260, 489032142, 634111544, -607732269, 327253649, -20607200, 260698665, 693174522, 915486441, -432850610, -265632489, -512624121, 484133861, 137127740, -618672866, 953864829, -184509795, -337703383, 195706116, 179599977, -729427200, 324402538, 441101181, -856202872, 108530723, -458484653, 310302455, -941150008, 525248799, -529223056, 892514883, 169869562, 236184456, -990226439, -106792764, -842613458, -617645046, -478327124, -717773122, 800237162, 320503441, 726715050, -286553285, 625980196, 88381107, 848868703, 569162726, -55778910, -648836859, -584343323, -509676062, -49033727, 495092910, -854207790, 919230038, 114811268, -656597249, -462924022, -753845049, -62053907, -980665318, 227852177, 113319497, -694484323, -218111634, 300046969, 618610994, -944391958, -26566133, 445034106, -860671623, 995077374, 804377833, 389275752, -34439179, -230399094, 353793557, 117891319, 471323384, 359976905, -118462214, -506684321, 758318768, 60658579, 966759154, 52817139, 909618419, 32398040, 696814053, -102978648, 34741998, -688158299, 746630890, 773352362, -299593304, 732452650, -802931298, 467685357, 747730498, -327968049, 355231530, 513291346, -258231696, -832913575, -807148728, 124867556, -423635990, 891743152, -812780230, 169947346, -983341322, -469685194, -796565116, -354222017, -383182720, 586043496, -268297198, 562921957, -26429449, 343701964, 168318950, 526467268, -571095328, 916935675, -890885863, 246600089, 147588689, -593960417, -304926093, -239438437, 193054286, 716658970, -658329038, 211188756, 799099627, 444334210, 661490854, -29137355, -640895026, -591798877, -794293756, -434814928, -304085818, 115679986, -434734726, -633273182, 939619133, 501239622, -283384650, 283964069, 177678245, 824514175, 954167279, 632230698, 834968031, -467120986, 812036960, 424721367, 990962522, -306911212, 708523254, 288281489, 134556764, 832917287, 540521010, -410887131, 579272990, 949042065, -866848021, -466431808, -431274131, -922579507, -335420318, 614796695, -528172851, -630167296, 142124612, 201732309, -158986371, 140879549, 176378583, -842726675, -36418057, -545894106, -528423837, 504142313, -735288294, 580587045, -638285016, 585532086, 443090310, 136348398, -663473607, 116427853, 117822914, 765667173, -316436510, -693385084, -280245417, 68364503, 799069277, 59036352, 434325203, -316253053, -406438690, -469754189, -79029514, 109785730, -509337969, 38624808, -607680932, -770137696, 499960095, 910124683, 464551453, -469241360, 398911830, -999690551, -955411584, 726049123, -56813310, 396712841, 353294649, 953751706, -680677460, 97372812, 51713196, 575108775, 304834856, -515245513, -579099731, -680922247, -307623156, 674723035, -252658726, -486743912, 344061729, 138023033, 748631365, -854651414, 224366371, -534651751, -437595804, -386928822, 997833331, 875847893, 298116884, 915175906, -194887648, -241183591, 1000829, 322581791, -703165904, 853522736, -437900785, -405398143, 351374058, 294713935, -860968771, -710086563, -962549100, -13665640, 146574016, 411274319, -213312982, 207611377, 456990798, -480546503, -465202851, -663031082, -409204381, 569349233, 557615365, 279236425, -178712298, 801020530, 93289807, -968409794, -335968823, -440225128, -631191528, 666629818, -630133365, 47924674, 725658817, -611993221, -495382718, 833477657, 361402028, 289766898, 23755981, 396597165, 982717614, -226880827, -391198259, -157986072, -101885845, -639767143, 412505649, -252072295, -350540973, 779542367, -613825993, -747631644, -634838842, 741256108, 583069846, -725135068, 725125385, -935679119, 553894144, 193355254, 463482119, -471879612, 179417604, -571436594, 626629308, 902900212, -242827284, -965888359, 921132419, 603029916, 606596377, 572152171, 974724989, 513461251, 185687215, 48722862, -821555167, -924496304, 754652126, 883963270, 45334887, -825438895, -898439355, 592558294, -174508524, 612413823, 207046618, 331401510, 133929744, 338048912, -470991273, 790972376, 919901541, 268444764, -296824778, 778179184, -686209117, -545434142, -98713293, 365076287, -889339050, 977605570, 994693470, 221409441, 860604149, -454060218, -297129795, 939497753, 949379727, 975294522, -310652982, 741126080, -908234949, 670661030, 664862163, -1570203, -576579845, -65356115, 230663082, -219325026, -728423270, 64767482, -539577832, -816101567, -903622494, 521643885, -458180770, 931429402, 656702161, 825149046, 20435626, -130122159, -524697445, 252978369, -507170740, -745131413, 368683318, -639354461, -216725906, -815469427, 588604391, -921344493, -708031442, 938038399, -473789114, 990353917, -364786438, 781682800, 432874725, 230361171, 412627514, -204442249, -410542916, 211616731, -42190287, -108175994, -667266891, 418179594, 438176274, -69800875, -886832005, -567968703, -779522648, 517525729, -243739718, 18782457, -816902379, 405583761, -74254041, -993157889, 94468847, -802245712, 313183675, -278112190, -154857858, 417212664, -54531645, 602331529, 75014905, 75741033, 846995796, 882577015, -297957161, 150040406, -499752185, -892552920, 140878427, -868611819, 910686473, 257022340, 243882361, -950348273, -349095911, -828907014, -912465871, 961212946, -908774243, 543654162, -539556771, 702112753, -165592906, -662022807, -516880476, 919935935, 617540107, -215554496, -327779045, -20158287, 623931971, 284602297, 120629266, 633849698, 574715084, -658631786, -425245206, 538741601, -327154376, 34568270, 117193901, 91505913, 321843759, 313359558, -857717206, -52790750, 778321410, -902983432, -301156348, -917072617, -218215627, -385954463, 352788855, -144982928, 291639261, -470184317, -881253319, 41018246, 418651771, 330509488, -855117904, -592418188, 192217371, 572401094, -391735054, -204377181, 613726263, 662015268, -885421265, 872229480, 154298206, 591215229, -787790299, 508416177, 33460400, -150462567, 844647427, -873843142, 61147865, -492215171, 894443177, -396290304, -354887838, -993217809, 766841635, -49154300, 956884219, 531805693, 286297439, 24429470, -277803216, -559298502, 897125882, 921838692, -284863403, -733008727, -716105800, -824594395, -975306749, 637870556, -953124396, 920462899, 839837181, 782293422, 310658749, -16039289, 536400977, -265988667, 382062818, -75182469, 42456125, -157876492, 106022630, -264101439, -592097452, 74145119, -807874079, -344989202, 490581150, 928272545, 563894518, 316231812, 304292056, -202070619, -221011289, -238593106, 59590959, 220743542, -49660495, 830065733, 635392733, 82865626, 958020314, -521779256, 529574796, -638907511, 699457200, 783794074, 376118845, -386089306, -292237631, 603289922, -515082614, 471921166, 405100010, 212066200, -286689647, 76202730, -696270606, 511912305, -611355670, 690981724, 931479972, -329530927, 334752737, -776820373, -245984453, 890258291, -761005586, -912924899, -309986938, 561832572, 373594999, 971727613, -31225781, 243555136, 951712205, -716267570, -915887784, 83572000, 720840611, 926584499, -213057822, 74311441, 930396347, -677494987, -453926940, -260881254, -94049583, 528274122, 411601624, -380342646, -699317629, 177568819, -161764979, 798896582, 269151945, 296533921, 707092235, -864653906, 312925500, 709118194, -799412847, -368594859, -342070348, -400980860, 759291682, -298470118, -702987121, 984633985, -459706474, -650743900, -605059558, 141855345, 508276902, -884355319, -343371916, 812404709, 364816175, 912534940, -247957634, -38566117, -855668841, -88309815, 897085660, -708365175, 551799526, -776978602, 268922138, 389512407, 45888194, -975099335, 408157710, 372934292, -58611909, -217744706, -879720650, -481761418, -85918713, -543912715, -733602957, 131451041, 602329667, -260739027, 941887398, 607212345, -696019262, 451116251, -59515538, 484691345, 285779691, -506640338, -893777447, -125699569, 734214119, 597914228, 7297449, 465114635, 457807552, 950781488, -154443269, 53638676, 495344193, -225701672, -307487140, 76653163, 678298820, -497644339, 47850633, 303747343, -970350047, 509172356, 24874425, -143889973, 278137415, 968514377, 198620472, -753023749, 770874488, -527874028, -289095000, 755937673, 695683255, 751041623, -924434344, -444510097, -197315345, 106048003, 318899008, 317036860, -73629505, -790656740, 135167755, 379328471, -16003404, -692688277, 439940733, 234187440, -151432757, -515211871, 540393069, -133361377, -975679238, 633881840, -793532276, -727105773, 670002106, -711877146, -715981080, 925927658, -827275023, 174087331, 352620119, 642892196, -119339320, 549092968, 942082524, -574684483, 767424432, -758817702, 11471651, 919795832, -298848097, 7679435, -18449231, -876888898, -406493014, -326546188, -15602693, -566903478, 808692677, -340321538, -386241359, 193086073, -688723994, 573705336, 817763147, 250304333, 405859498, -74669774, -383787054, -161669186, -39511306, 170297477, 821126915, -631711377, 689576190, -770530602, 497222655, -683652404, 464489290, -895977753, -609690032, 640724897, 416443614, 896245332, 99845552, 981708556, -11317561, -981709715, -816877246, -918373776, -552485337, -354124833, -167567268, -684357172, 285643388, 989715045, -369619640, -10771264, 782725557, 61132985, 4970839, 22337307, -4515931, 24511895, -364218671, -718211153, -632163421, -259006087, 548552722, 406714728, 314393895, -109612560, -434662343, -708612859, -818080734, -605882749, 771498521, -899048715, 689884430, 671608025, -962233028, -227513695, 330977629, 148740057, -348499663, -674644074, -333564918, 982733168, -579805284, -198149960, -929252105, 812824653, -69744112, 881702939, -133037938, -883346629, -692629068, 339806899, -86263145, 516531830, -159271655, 494305523, -4842015, -568422711, 715309950, 858461537, 853614033, 77931461, -338063705, -880670598, -1065890, -908280700, 193844710, -454222703, -597842149, 573747342, 975582855, 940853506, 361290684, -808463886, 375465358, 129575867, -321373154, 247761685, 856248562, 553478748, -3273216, 188488509, 804947987, -672526102, -920715059, 325373419, -200485262, -341372435, 933011776, 175836245, 452534163, -68483481, -932318917, 229969572, 754115569, 18292333, 61928011, -637076819, -186449177, -431732695, -402927867, -803767518, 317099295, 912393434, 745243709, -286136854, -171463127, -238426234, -604917159, 207440442, 99452349, -690587557, 697459436, 401018708, -571361829, 25565296, -289202533, -912324711, -309147807, -383354003, -763995052, 563224716, 440189389, -195142489, -724184176, -900179564, -510037313, 200920133, -850489140, 429683899, -783676774, 428841119, -26715790, -464263671, 199473527, 308091750, -119995381, -700439447, 126301004, -148718102, 772039480, 46768342, 994284226, -373702444, -113462789, 567747129, -539422093, 202434885, -213029860, -492571851, -234580534, 802125389, 619595998, -632757883, 68975488, -529353146, 214527713, 420748807, -493574437, -364116790, -382243611, 536079605, 751094669, -789553652, 836367781, 411783547, 215609395, -220579058, 859112358, -557054448, 754338662, -923727433, 553648914, 247886775, 199452724, -774174498, -277198377, -166008813, 264950455, 436027973, -944977353, 414474842, 870666131, -671546403, 372204100, 35999505, -304138013, -89340108, -185544620, -934131326, 642093612, 362523833, -5808778, -714636525, -760403408, -634614807, -477209521, -527466123, -358002128, -342955014, -170957232, -737732317, 505937289, 852012774, 756145348, -748201443, -935532811, -710433330, -696877764, -3445198, 752566137, -297070342, -860839966, -817867310, -522232320, -485149288, 844574653, -660703290, -911903769, 62892360, 435055468, 130451182, 618352364, -648325340, 190704070, 744100178, -949334024, -317152186, -1025406, 967229391, -764953837, -576033114, 482020450, -786092114, 389439970, 434675948, 594141511, 176836606, 204654465, 698858976, -796091089, 356173889, 611074081, 470455600, 269526221, 586563045, -317479628, 943173972, -688323888, -79035894, 826622753, -893324397, -416045169, -60200646, -434120863, -61086179, -281821328, -458033303, 503371322, 213757754, -817298075, -390485374, -741600821, -886674307, -448184027, 715217566, -935625603, -639383411, -112590245, -965882461, 435796740, -832433590, -462030872, -961546415, -88573398, 911855714, -131831767, -856497202, -615320775, -118332860, 421597189, 76113927, 547417386, 696343262, 936575648, 769975083, 719327872, -143457070, 464823071, -15927430, 784544409, -375635058, -847057444, -601869734, -745261335, -11700022, -5729277, 833052766, -179137557, -433390642, 582711762, 769618016, -115416942, -369630092, 618672083, -254805777, 766812756, 63579675, -280859807, 418418145, 340779254, 948395751, 982834405, 538452213, -523982302, -921931661, -471892291, -779967979, -493629232, -468812440, -985673392, -790818088, 374261536, -197932764, -413539337, 697732128, 825056315, 764807444, 296306748, 996731738, -285601302, 377202659, 590821375, -781065688, -618428189, 834824587, 12536823, -811073207, 363801325, -251462354, -618708053, 572945289, -457900084, 45894844, -323687695, 893386184, 392807715, -577608554, 81012389, 153349160, 752316248, -170493354, 177215331, -951413466, -275400922, -180950913, 876177129, -651955038, 592314044, -769344820, 229742438, -317428637, 77330210, -265780584, -402110283, -515078832, -369503806, -577731835, 437698081, -678473001, 164814950, 370715218, -253100843, 848708864, -408344925, 683246861, 99944279, 46634648, 648243241, -392082013, 812387403, 615822794, 245310145, 277470491, 201385965, -918086452, -980966379, -127639868, 384904809, 228347143, -853447862, -515520150, 588725579, 448631020, -448246953, -596238974, 8201418, -759823989, -797341419, 382845442, -856059511, 554719120, 110075265, 68996606, 33773896, -275766846, -869179540, 506318593, 145745636, 316411149, 917453383, -853971554, 513530604, 55150804, -338067830, -825899226, 983556434, -50009426, 121906602, 691110149, 224352424, -751239892, -493624085, -127517863, -815327557, -268896118, -596639597, 989228956, 831075198, 209537486, -383499074, -41860054, -457564934, 851154691, -844354848, -463299725, -195892224, -604195974, -598356482, 695816074, -743991935, 430833735, -38736876, 20219925, 751292962, 429806774, -801067744, -410664461, 183542521, 216595296, -539262631, 858265545, -460172693, -683097078, -62430612, -165376565, -529778334, 918525103, 291749497, 157592753, 133850167, 61951110, -204963086, 637688100, 888315783, 898828853, 233604910, 930173805, 998589048, -632276070, -971809259, 982713249, 864753521, 334374844, 505033125, -994479175, 691051912, 400929230, 113535194, -803152151, 397177235, -232041768, 710013947, -767332854, -957539554, -504354742, -881750644, 380243635, -459352628, 618892374, 176994603, -187041940, -23643206, -89725375, 362748414, 840249678, 87186343, 479380246, -592282228, 237739363, 393228379, 338345165, 830779335, 582257199, 400475967, -679274514, 201769635, 970801801, -726773924, -985606507, -450472178, -916316084, 252846091, -986443497, 591476212, 143014822, 188437629, -642011636, 649683824, 375553501, 920772077, -972531273, 639449126, 412785225, 758817619, -191791339, -713211613, 455289971, 426637080, 292633437, 717615910, 80947379, 380750147, 278211937, 538561785, 979508434, 385664642, -489302828, -559392210, -315477853, -547149923, -122773512, -474150319, 261884532, -703621843, -675377828, -795743501, 794330184, -93758235, -111338783, 864583125, -232496745, -94270224, -612484554, 358532315, -614499972, 966480851, 906261954, 332104625, 465401230, 690982073, 166084109, -784196704, 721883117, -768681587, 954360174, 311867254, -379021202, 35707906, -8232511, 756271758, 392104890, -957533088, -517678190, 171136467, -500994159, 941366818, 700742371, -720395728, 481296856, 551708298, -780500548, 158742536, 714240343, -578783712, -414893048, -59447633, -548457729, 166445479, 643325121, 174133311, 38705660, -528131613, 255689779, -759886627, -591572041, -358680149, -788994913, 471168206, 237862545, -118714586, 244962123, 229403810, 22475694, -455117172, -843556413, 393562596, -686695923, 373632152, -322120516, -574999925, 118403561, 534995809, 493209446, 766117055, 263107825, -839606414, 794294465, -609536250, -864846052, -529351048, -409321478, 629546233, 954896127, -86773607, -51912318, -552848091, 789039769, -240294990, -637349704, 394531705, -643988653, 701861313, -494839241, 894707837, -494705982, 703537168, 43134423, -737939920, 264386946, -367985027, -204574700, 242203977, 793802084, -339541965, 983612283, -492263412, 419602897, -861112591, 701308682, 10670453, -426341478, -6234914, 686734360, -302663370, 959241953, 431500917, 717838224, -267668720, -161255247, 225385679, -925068367, 359396320, 949401636, -843938338, 17050559, -951654805, -237633225, -222109785, -92028626, 688303778, -357504907, 570922612, -471126618, -745560680, 316312585, 436426381, 532162768, 699882215, 972617734, 615311894, -277752250, -830838730, -177816981, 661593925, 69110393, 752137611, -978057253, -193679474, -458800818, -620111461, -768292645, -480988963, 261606249, 353172963, -510400522, 17861385, 773224543, -145162876, -342789733, 679171418, 780057331, 983698773, 147030718, -394179460, 477173974, 860600211, -444854317, 863255140, -850670092, -601248589, -702315707, 132076782, 763656467, -704643052, -287189265, 360931883, -643913244, 709336329, -340618877, 4309423, -914951172, -971459895, 813643350, -530069397, 387743053, 95029282, 785241293, -990752744, -982300900, -701940304, 14170181, -25781620, -239277017, -586861802, -314406620, 54041914, -846572170, -931615965, 378649271, -975616002, 830579620, -400189763, -326166500, -787027548, 6757119, -507682509, 879058940, 826937671, -392325370, -405434561, -492691126, -752819574, -898339292, 297956131, 243613078, 838487059, 605339968, 802044228, 687558391, -554519444, 490975075, 381399823, -524847989, 294188191, 569262061, 912459784, 852016365, 26774032, 605217107, 935419841, -894736997, 278214312, -232438095, -138769896, -917984853, -25193968, -929653191, -927208469, 379263798, 972873133, -761595572, 994532348, 28893872, -192920520, 668293482, 131690430, -153585955, -555043702, -76549963, 474382748, -170006132, -961247368, -812536809, -140776561, 573446694, 791740940, 627023099, -140865089, -12052330, 725791400, -237310936, 539890487, 647931088, 166756735, -575613058, 396793532, -137825669, -513309159, 916685088, 5120008, -532184845, 74561515, -929329136, -212005845, 485667783, 321090298, 354596457, 326014783, -374181546, -178354067, -848348495, 564882660, 962487278, -550595795, 674548541, 377094249, 2245639, -782218985, 379611419, 121492180, 927886370, -911918306, -57431604, 627917833, -101106313, 6732552, 974519012, -984837520, 48722789, 168690265, -142176459, 944572355, 744182475, -639484717, 846460370, 938947227, 669911849, -498552862, 350553325, -209942090, -883287757, -87336666, -568863771, -360786275, 354850831, 5407202, -380714502, -271363011, 55918789, 839559290, 984230157, 535150113, 354640626, -686126406, 195665375, -339261045, 26946489, 894069421, -437289640, -336347439, -492165130, -944861973, -328837743, 836525129, -932597747, 415719385, 211464200, 948359100, 657624932, -352160574, 892283334, -226508808, -894356608, 69987617, 892916552, -74208154, -575826242, -369380375, 444425728, 886345652, 945481643, 934751925, 740834537, -794822942, 897813565, -421880916, 389462893, 280174410, 356507377, 394322302, -951721336, -529802800, -127285248, -667525963, 781767394, 942605390, -167792874, -573967780, 365722346, 90652769, -99208859, 843980887, 859980766, -745784533, -18478164, -134291677, -271049655, 921011474, -617197128, 924708901, -699514918, -486318320, 716181698, -848609520, -612395737, -120023211, 359725781, 292255725, 154470946, -593300407, 184329893, 346473726, 986524593, 151679630, -999481753, 893174826, -397754864, -140967740, 935474533, -415175792, -448257656, -84480487, -474494166, -487148962, -699779130, -292026678, 512700068, 596952210, -725750076, -391028818, -764102262, -249646979, -763273381, -184634859, 931821061, 752669979, -470280308, -430677045, -208209620, -958843581, 632501198, -202192539, -423736449, 132272546, -954873502, 381256223, 408917556, -159450278, 114205712, -168056006, -727107309, -558475379, -731132947, 65939591, 738264786, -585148549, 339624483, -557989575, 65543853, -671033430, -953024370, -724127507, -298313455, -856052640, 243935170, -718347679, 702409720, -198383960, 461728177, -499822766, 827692193, -304201424, -195966776, -571742162, 965647326, 991082462, -184363404, 993287718, -455808797, 593706041, -781263998, -528139235, -301119514, 415816611, -462376347, -616693036, 367812529, -618936457, 883119844, 100742799, 49865589, -221901509, -724109970, -799350991, -891992714, -74987367, -632965641, -281359421, 526442297, -937995437, 977165727, -568769349, 911719716, -90959088, 390602106, -741507291, -69238699, -331357848, 460956606, -690871359, 537596819, -758346888, -466714244, -856432954, -746122548, -550150383, -307378399, 868133070, -867744414, 181324214, -281847817, 242994101, -377525167, -293478634, -878463998, 50049090, -631224873, -515939128, -550784422, 650034136, -182235192, -416512941, -829699740, -753201590, 613705612, -864881188, -717394613, -414611440, -18637553, -259078, -460308684, -641980695, -328765853, -265340078, 442214452, -770960140, -251054209, -394617529, -570361119, 21695113, -271683392, 191275153, 216839894, 969829529, 839998826, -77460655, 651157264, 83698137, -310789868, -320939658, 92320216, -21908985, -399658472, -264461573, 234141630, -822333628, 652285967, -902992217, -615360391, -276656060, 347530780, -414117715, -947956983, -509427684, -708265448, 746811559, 900223671, 342538085, -220731285, -366683857, 168309556, 148438364, -507825676, 469748433, 235174065, 696105731, -635132586, 215540330, 359157228, -721895171, 565933969, -209498068, -504777472, -637731049, 850303478, -50742686, -790123746, 56481349, 739147958, -891324282, 594874389, -44931457, -799389970, -436947365, -894115444, -318000281, 197976058, -41729319, 901902512, 176682583, -7126654, 56515339, -557085861, -72254211, -312010395, -525545268, -78405663, 429878437, 219575487, 291342323, -851407852, -306284869, -272179770, 733296507, 105056049, 640741592, 579690348, -897940832, 510309117, -939589206, -631962216, -143082592, -593988227, 493945886, 582589029, -240080985, 388628721, -782364584, 988929859, 934829095, 574404282, 610224950, 601839821, 959370082, -284606896, -141349776, 417243210, 58764713, 123261150, 473362082, -21952681, 64996283, 157571422, 918931172, -230637338, -194310171, -992277828, -873703534, -235932867, 823932502, 680702374, -30643967, 987238728, -536903994, -685567478, 977409894, -38050090, 940706896, -401646778, 973041198, -713204094, -911385546, -771657796, -233185393, 189998839, 277071107, -927725182, 199324798, -810743039, 626241035, -820038404, -864218832, 130966794, 895845269, -414367605, -834920903, -124084959, -448059820, 465806800, 258404851, -893517776, 540544596, 112014366, 347579500, 561171243, -918733896, 420933087, 404192465, 67726643, -15089787, -849984228, -466977403, 376358642, 488371400, 716970818, -286734372, 89266306, -918220031, 606966169, 492835684, 622216107, 667917080, 969604719, -179798040, 197352746, -573384465, 164636344, -454995655, 664904813, -120562074, -6241507, -993128387, -90148474, -801495899, -895982984, 664852504, 321006742, 870568067, 585872314, -144699246, -284872096, -297335256, 497028719, 743052918, 180611474, -615402633, 954343149, 940452838, 183111082, 811481368, 571317718, 42448872, 100387770, -66120151, 221083886, 408707985, -735564566, -784626054, 887812428, -431237002, 882993372, 895233627, 151537949, 2416759, 669948281, -647109891, 885905033, -816239251, -441925730, 452003036, 395019592, -14415452, -238190605, -835707648, -71640615, 449091751, 17771210, 369388390, -720269308, -175370116, -852556827, 572447959, -98461408, -358010850, -816100163, -57358230, 319505475, -993962918, 509003604, 348344369, -644520509, 650879543, 197238, 327547968, -189000675, -852101772, 375509873, -980095013, -628547664, 65862310, -18950897, -634163697, -359182799, -551322525, -453837563, 752003752, -404882211, 157627838, -825339134, 147853848, -34298751, -422816745, -88475045, 805152702, -880745015, 999860103, -896444540, -575532048, -595166205, 416682155, 664142854, 22982690, -858585167, -501649637, 257638890, 14784358, 713304054, -529008089, -620163409, 101833119, 83716513, -2201907, 665985808, 69188209, -676001131, -934636493, 180069064, -339881268, 63419984, 366406366, 400209484, -372728166, -111594280, 965124968, 70774643, -862587722, 957410942, 913877612, 427724588, 379271566, 295325056, 579852081, -848639173, -868459274, 867349952, -245728485, 675485155, 575105634, -338341274, -257611873, 210117200, 510354816, -75558183, 663735603, -234748379, -105539777, 241411455, -823230823, -735027784, -851837438, 844118375, 790344165, 766462784, -882624471, 189877268, 137090309, 619704062, 986623698, -393686647, -462577278, 694363393, -526525716, -629478230, 412047522, 373835617, 240586122, -35405136, 337418397, 683093377, -287837419, -756423788, 705805825, -616816117, 545955234, 598733304, -995064922, 146070925, 712077898, -9164708, 955682385, -124242659, 761288974, 84495894, 470501502, -659238453, -444550147, -251086152, -220442957, 631476405, -651965922, -755921485, -409222470, 241436776, -244639556, 86968975, -507991385, -725051459, -170173179, -32576390, 821483417, -614699661, -457981202, 344430355, 668939535, -838829238, 46450359, 616190826, -394718213, 639124410, -845366153, 811737153, -771576334, -191570742, 53234504, 926693923, -122140745, 826912797, 402027332, -99128657, 749389535, -582364362, -659846982, 654309276, 653765783, -208396893, -554261672, -141285529, 269713189, 235652138, -265527848, 231485209, 897574765, 194846108, -910518468, -406005700, 783359663, -773468778, -250471180, 496446820, -521438839, 691375409, -462542909, -569614667, -306668713, -221730417, 982128114, 474277813, -134351449, 837438165, -753300775, -512610205, 545990263, 778277706, 755010640, -545836991, -567530366, -589294112, -211384175, 505180745, -287321212, 48949702, -737930264, 223427387, -839791256, -490867141, 557475711, 316033169, -962404029, -757296339, 570647320, 669315151, 972401522, -300019511, -506088596, 589225622, -210913686, -264478023, -319553586, -835191835, 759499958, -497339609, -602307507, -643558772, 906744062, 179895994, -471389634, 504071804, -418462550, 796634685, 425238543, -935041647, 638436347, 772715556, -148356106, 598239027, -605974814, 147706340, 572116929, 749636288, 687690210, 213926092, -481692324, -712993672, -385060918, 822328299, -900419054, -899489207, 288297898, -739470831, 812256495, 232737665, -417521777, -480549480, 167499728, 748185506, -103943231, 430320726, 401354094, 910339323, 661999769, 464789033, 610549036, 620492558, 956500557, 258686398, -547985068, -859057573, -510130185, 68830702, 706420244, -237792750, -290619999, -394851555, 258025618, -920431914, -855670809, 245379841, -387142520, -808507823, 159771029, 25010885, 924800307, 812265210, -457535889, -142022151, -511444144, 790614074, 265171440, -578040450, -684134618, -164196367, -395945159, -397993513, -124834769, -21192623, -27113724, 378368342, 569998972, -130970308, -43076986, -650417468, -213341113, -452167933, -555302576, -14213583, -609931685, 234022068, -234718402, 78324118, 328309795, 86297926, 792696413, 367776074, -714595368, -562437378, 40144388, 93267693, 698508227, -59019570, -233519815, 473285830, -526826279, -667328054, -955901027, 366025929, -706578385, 327646162, -119007172, -242209879, 4358014, -369956467, 279536178, 461911987, 577118293, 760061517, 917095618, 138851484, -383422974, 951499175, -816585583, -335479626, -780019410, -265826645, 533898630, -725417472, 757981532, 551819204, 690093916, 379413412, -816496181, -269648029, 739439816, -757339121, -488632591, 773324935, 165590431, 606271492, -788565238, 113646012, 754400080, 859645983, 642806226, -163209550, 435676559, -65495604, -217914075, -338442144, 272317261, -710564266, -810210635, 659156019, 721465267, 451713147, 889077044, 55776330, -121938855, 260560868, -614532010, 680439960, -443466952, -472264291, -762223423, -432134878, 27701472, -577009351, -806601690, -553669377, 115840457, -941545057, -263343022, 124416701, -18545820, 831381591, -138825623, -305373899, -941209282, -588160340, 394172227, 290608366, -758509584, -105681937, -938284136, 512453251, 493743971, 962002657, 305730606, -219964787, -601751328, 976846921, -2168478, 585131864, -595741619, 197574049, -528487172, 544752150, -497015075, 455197938, 946489123, -496473841, -672844518, -456482230, 235858375, -271240960, 355393168, 107857566, -178493449, -91255574, -607265643, 537031843, -429309795, 603794768, 52375638, -692767506, 181213952, -516290089, 141128602, -943700438, 943914208, -330955669, 913031877, 253012908, 744425513, 92345716, 696589517, -238300497, 881176718, -778948710, 860507358, 917921382, -311622052, -557375561, 89324137, -403750370, 354796505, 782667570, -111747183, 635253560, -912870135, -103495142, 61850771, 925590225, -215904236, -980099129, 212707463, -944716528, -321693773, 825213004, 43832210, 748216348, 814006808, -188760847, -161318241, -276627397, -616721478, 829600224, 315899719, -218075334, -677249535, -411253024, 311681332, 923909269, -855599525, -23281855, -64922750, -671535992, -366244002, -180823608, -931770053, 195608445, 594535879, 658638931, 834972127, 389933594, 824937383, 724814123, -316617336, -188982043, 277222018, -269246477, 818381490, -501233029, -120128678, 558694787, -753999290, 127124133, -720316174, -207672274, -993931619, 331046080, -984900526, 687436526, 491778578, 730820612, 33628146, -157989518, 634546322, -893825913, -930043183, -44622538, -3793087, 520036921, 660156545, 671630910, -828137370, -934998827, 513772773, 421806109, -356053484, -849306910, 40351641, -506362836, 754542186, 53280844, 701009807, 90377761, -504854977, 271212959, 648937208, 460785637, -464763846, 283862980, -948607572, 808015834, 86198064, 74431471, 319028282, 105741217, -440523153, -760050877, -500933431, 903686028, 810670518, -761332451, -582177747, 204266135, 226694118, -609108023, 489120682, -32004061, 607530598, 133585664, -318633665, 482731371, 900443739, -816097679, -564619058, 336813823, -984419457, -815938711, 347187701, 997610888, 598957899, 665791492, -983731159, 992558849, 87115480, -933349282, 910542879, -830107584, 785413045, -870732286, 494880268, 81332682, 660344116, -604385433, 726103697, -26589800, -678192592, 626307725, 609341401, -335392840, -893133487, 328500001, -351960454, -536454232, -946892774, 773195169, 263079799, 499849297, -6210889, 837696215, 635023662, -963196946, -299505875, -805451497, 391842696, 15796560, -983851429, 832281305, 780217067, -579676110, -664428010, -409669794, -698871002, 462711093, 683024029, 704567065, 793615031, -99076311, 211884404, 814007303, -241612172, 623236753, -406313639, 405309893, -504733531, 978513811, -453148350, 514837418, -496451998, 644955291, 883020948, 819567225, 631009055, -885722200, -830926254, 31507420, 953039192, 34185099, -369782825, 335667478, -192966788, 7468336, 247575283, -525380419, -804421646, 429982939, -365451412, -636092291, 359244405, -272845105, -508901834, -359879687, -943140592, -682504625, 818272420, 815731692, -338407154, 254317552, 752821052, -939228816, -224095014, 940983773, 47213316, 228504582, -305340663, 709519205, 509493370, -563117200, 570890817, 330161114, 376540454, 124931029, 737513427, 251657865, 875086572, 59922964, 188652455, 803128616, -595694950, -595613844, 335505978, 445589295, -508250824, 914883922, 955442726, 794369525, -768757840, 377433480, -871138103, 110749705, 43929338, 23318600, -92672044, -834845760, 32606405, 537642530, 823282933, -468791472, -872931549, 380283060, 602721514, -702438247, 51339625, -733763750, -630100050, 955828184, 984408538, 443876844, -730636828, 699855454, 223952085, 355812636, -423904578, -426116397, -246941686, 585805209, 384636772, 223265365, -957804973, 110779718, 985963259, -656140594, 120776205, -602459999, 661231302, -307363801, -292588936, 771987745, 603287743, -139346693, -452630869, 239020205, 114704717, -244258343, -217147933, -595170610, -403824781, 71793551, -116363718, -858119315, -346638069, 905504921, 185301382, 908597509, 325900313, 759839742, -424831055, 692106376, -869110904, -453190923, -417152993, -7696243, 776371849, -992184736, -740359527, 669656481, 217431727, -674756533, 183355007, -469515613, 310233212, 103693882, -207855024, 995005750, 72699306, -247478590, 94762703, 474614091, -897173833, 536651619, -377547100, -211805710, -17671104, 866396560, 273337763, -631247851, 534457029, 631168287, -292788135, -493456209, 661630016, 752669661, -510436613, -364153873, 159062157, 191150149, 809919461, -769290888, -698324750, -92156870, -479381837, -686879841, -476838773, -805898123, -91142765, 453747394, -769870113, -773629303, 197281952, 34146091, 862353902, 261216279, 543938704, -96025472, 855564643, 209594013, 353699051, 789589944, 721403405, -749406423, -397885874, -877998811, -783688045, -835836541, 406355991, 285936211, 190693875, 962113254, 862914747, 947621327, -140664901, -601540680, 88902091, 250144114, -205711097, 534974236, 560705192, 994515801, 235277692, 41820388, -334228810, 897712479, 765710040, 998478500, 460765180, -564963338, -13503153, -955462695, 77232147, 270066116, 195813706, 643136497, -224578298, 5605859, 742969888, -923206197, 353898428, 863984995, 100600954, 425736838, -394646681, -267042835, -863332887, 294610263, 354124960, 907431882, 719370584, -742501915, -456532489, -52318340, 978028794, -44366477, 176053727, 308201101, -933658349, -551538492, -395216365, -751909995, 406300024, -582248920, 310757029, -294366949, 120156676, 795865031, -538363359, 56228363, 987992524, 525126177, -991557697, 494374577, 315820367, 274898400, -986728197, 193888535, 437438276, 595029372, 186934526, 729172229, -365859349, -948286618, -384662017, -324791831, 778565494, -71316193, -552560161, 986026327, 312168276, 125620697, -529244030, 899400004, -136011466, 290235869, -373828515, 658197192, -183638160, 169648081, 592194601, 659440112, -688216751, 354965034, 458188539, 462921922, -186079054, -761721531, 297379036, 573571994, 84909612, -77958477, -79068713, -30687684, -818728645, -637375544, -824246836, 774524888, 972551734, -715387624, 123179907, 526773036, 731856414, 88724236, 928196761, -876238171, -324749059, 940083341, -785849293, 805867048, 612130358, 213111330, -248385915, -281042963, -288803666, 292795655, -293829362, 798121207, -975839464, 16673398, 939665709, 328539142, 997991063, -110548242, 464181035, 619269750, 141946951, -36115362, 886875527, -655362225, -21452382, -20011498, -619588867, 216305951, 576292850, -162059376, -792435021, 756573927, 117188149, 858150968, 399187045, -850572701, 330288938, -372421768, -630335551, 886791445, 11600358, 291400710, -104011821, 478010017, -186219950, -562949140, 267303041, 510529812, 591817966, 763681113, -949107341, 439547614, 869489917, -618300366, -239145375, -2939674, -154937864, -440381915, -736336562, 577454002, -524067405, -750141341, -8222240, 962627785, 806245342, 525035028, 851366087, 530424626, -917847103, 196777305, -925116353, -236467788, -131046675, -378894255, 624031392, 197160813, 906360164, 518344963, 446710829, 152797947, -187048059, 903762906, -619686331, 300004570, -200102762, -76390193, -707173702, 319060230, 843329466, 265310082, 364103948, 281280949, -241406958, 828139402, -191911501, 15073894, 682771175, -698590570, -884664190, -672611996, 772247254, 519830000, -163479254, -574640241, -880699788, -550851447, -334229721, -254992881, -249171378, 67915901, 35916964, 616165387, -414658903, -625188559, -302598562, 135316143, -784297863, 138826023, 633438398, 874704819, -289721577, 799132978, 390914097, -867474321, 327370700, -88216088, 322331163, -272014704, -801620843, -239795820, 864677683, -8943499, 979010949, 259283558, 518397973, 808349118, 88033326, -502995756, 64806590, 644330301, 605161581, 215984273, -253227672, -217251388, -881752151, 547837557, 984105487, 746645384, -46988527, 595589208, -134410422, -687016347, -651515850, -247207729, -490558525, -188433202, -909663851, 574262004, 658390300, -587510223, 725627356, -803089969, 21386899, 204097424, 69316162, 764023963, -812153715, -706584056, 67932448, 240233397, 792409953, 730653388, -831943705, -306796173, -135561444, 679507776, 290561840, 90966862, -102428978, 719419755, 905902490, -993454773, 741977163, 484615302, -278512576, 221579665, 693826937, 258271101, -798004040, -831210421, 178230672, 934470668, 789205426, -805150603, 506288142, -977313746, -106670350, -345013562, -88956414, -959988887, -720266143, -671995403, 69452759, -718600286, 333612062, -155439391, -145027832, 930396891, 922110144, 361608007, -880738507, -738188052, -142603366, -195173940, -898851453, 951074998, 755157249, 61472343, 530003047, 592219008, 322884881, 98710478, 443642044, 739529895, 741119565, -762533331, 443018025, 111743610, -238565803, -229764808, 481639412, -342705512, 33958226, 322133791, 469423613, -817347007, 623108745, 670603414, -523009954, 564714770, 763168382, -490950422, 444002081, -789005618, -426410355, -511179279, 832647726, 505851051, -787191944, -716716307, 930433638, 80168152, 750501255, 126302899, -762442103, 274796017, 457999800, 488632014, -950160323, 977600622, -234616580, 771253037, 21038198, -53141747, 128145351, -614754468, 541050014, -994648776, -456874067, -797470180, -637476610, 722003778, 957755559, -583637410, 636595448, -850135785, -624510343, -35413939, 882685544, 450983447, -567077191, 159413377, 950002614, 626585865, -677742041, 430612695, 919032072, 844809393, 452951069, 603220335, 972190369, 172898892, -774735213, -66583301, 313972508, -355679562, -810924578, 776473539, -214501780, 284406767, -399397101, 609901393, 566346304, -614191746, 728294351, 907437822, 936018342, 172225638, 174375608, -671578998, -932253429, 301240475, -790865890, -619501080, 372477684, -983054685, 90996270, 798420776, 46187317, -144577859, -592099804, -246338037, 126459771, -121475300, -913357438, 711985857, 722256813, 493538955, -192247843, 847689121, -530708894, -838154306, 735021322, 892449840, -355016103, 503526765, -309884864, -566864999, -217835584, 258348648, -870868773, -421379140, -262169315, -125667191, 184898797, 329936046, -100372754, -719598529, 498354276, 208734499, 789207689, 738137930, -775969177, -751943880, 288856418, -464072862, 237677630, 882061110, 905175924, 633157430, 404662281, 239721616, 743037269, -593699426, -870527070, -990991956, 962064414, 207405981, 430025845, 929163689, 233964117, 909000456, 824903391, 188760722, -125017851, -888302461, -313324722, 271502602, 11061867, -258855291, -559175997, -421719677, 192139752, 167866290, -237556295, 823572058, -56756001, 595414404, 5377845, -294068197, -654734595, -412568262, -783484846, -668961231, 33474698, 354735532, 240880199, 428318876, -878938880, -926466972, -998499623, -802324065, 313764189, -953175853, -146325598, -586128563, 265529943, -602280305, -246700734, -843960468, 497769339, 892812546, 811304532, -332655176, 752622330, 974098600, -804263451, 580102851, 837991054, 26853803, -298938381, -772443067, -6432801, -909922897, -103739941, 940666664, -75084768, 540582849, -79458768, -272587979, -345356673, -624148880, 775203143, 567796053, 555400330, 191346966, -420062140, -881051005, -682394959, -338242365, -177160099, -547474710, 195129312, 937158309, 603368672, -37274900, -802093221, -736925211, -675130108, 68332656, -158617063, 626521929, -305151366, 579433441, 610486719, -981395171, -283814407, -468950909, -204917832, -942171085, -515513213, 176125079, -971173904, -120349864, 429209640, -608424191, -72607308, -117757579, 41067368, 962159978, 627835262, 292116457, 868766480, 549015124, -537862964, -114065702, 604210534, 943895431, 917863012, 81319902, 855340108, -466957606, -925658490, 59516324, 379127619, -412072852, -339483995, -713874421, 385649266, 686914262, 391152327, -688138189, 233374695, 272519387, 409450881, -145815452, -32574997, 771158124, -992814961, 749619714, 302547584, -633123844, -59791007, 398942846, 354477757, -472647958, 845769129, 993717187, 577084289, -828799239, 523330504, -395452850, 278339425, 57907568, 226709755, 79302219, -66972354, -308934371, -809556455, 686891977, -524762328, -60493889, 698790538, -522754563, 803325418, 339520785, -540078565, 759722317, 291959480, 153861785, 218283695, -975976774, 871037225, -131368850, 36619909, -175301009, -95644958, 247049282, -303842605, -728409145, 634598290, 495230475, -38313751, -963792005, 388973163, 935139428, 497650336, 492709284, 771078543, 84758088, 705308228, -328166918, 372296881, 872001357, 970959909, 458259280, 570267711, 949489989, -350029669, -964239155, 749215374, 941558363, 726319850, 815633848, -205296172, -238293265, 917098915, -58104686, 376555431, -109588842, 842004121, -771168594, -464933000, 233154187, 971124744, -263041046, -467602688, 677113467, -315893696, 789049152, 178484376, 469501478, -225878583, 345582096, 257078751, -217455708, -202628550, 827752148, 600422080, -854481595, -284493079, -484045913, 803617837, -837857987, 703097839, 444521641, 533720361, -326238911, 860173296, 930104400, -767665787, 87234591, 673458186, 786271377, -596933259, -770963740, 429457943, -892096136, 920723321, 390081985, 574268277, -105909203, -197032424, -737053472, 669575202, 707095231, 486404991, 472473125, 397179936, 554075562, -942014852, -548145855, 2331537, -325264650, 829806362, -519387527, -39617310, 57097376, 809349542, 270878702, 752809145, -237858900, -535119997, -829938514, -28083139, -63044279, 488175146, 161554271, 368242506, -415205621, 51229939, 374911007, -435062290, -528428949, -231639137, 667105838, -241446673, 998253322, 822917256, 137685442, -43939363, -317666513, 240259422, -288136749, -287979408, 51809531, 454771453, -737245322, -260337873, 630593912, 91935663, -331719622, 838028361, -896541142, -942136227, 192216440, -779285557, 297941562, 899960503, 82905412, -749313256, 386305551, 930339593, -377983114, 639512253, -757112225, 688309353, 726186814, 493504302, -89510224, 814437227, -140147290, 780882757, 590160500, -346263182, 646904282, 125737897, -901459609, 172924451, -183527061, 283123691, 572343428, 647924274, -876624754, 9834611, 501792048, -456984662, 52250143, 196746033, -115458696, 590631752, 957078990, -517515266, 701096250, 814887793, -254185328, -110835234, -35368967, -51721285, -895092772, -158517274, -952813998, -213532717, 463024785, 872812360, -577890527, -527688315, 463142457, -460539503, 960310113, 836885711, 221692288, -941788615, -943318987, 925016635, -474653080, -67619950, 609141992, -435608177, 995720169, 140588908, -581646657, -316189246, 62560088, 142867193, 802856702, 173585414, 566235917, 79827399, -161509530, -906653188, -171815990, 827342352, -998099456, -23628231, -204495910, -748303703, -850089339, -700364527, -581279715, -76641680, -886306120, 394660751, -245093903, -470922923, 298807412, -307442583, 498724879, 701172384, -463395837, 36328210, 186863766, 537979310, -620309655, -989503182, 155675658, -19136881, 695790140, 871610383, 794935984, -830086506, -436319540, -96458002, 931324727, 466731015, -223185182, 961685386, 381092111, 514773567, -931657012, 954299533, 585487258, 930975952, -466064955, 844980404, -530721978, 98332668, 305731904, 699258228, -204769580, -411758459, -651362654, 207486713, 386263850, -224032582, 779236027, 348093525, 260327529, 856693187, -69378217, -801311600, 420240617, 614582253, -180764320, -49196584, 779416975, -410742759, 843128894, 486951042, 94144771, -370775264, 164667425, 798700466, -268306099, -274311434, -350039141, 698883321, -387522634, 836224244, -413509572, 567195303, 650254491, 687223412, 223351713, -700252384, 551846043, 66238071, -542242878, 336727894, 879241589, -143506732, 331260226, -670766436, -291958047, -30571955, 806539658, -377019048, 411538569, -494293855, 692081803, -123599531, 828145308, 235186577, -492983310, -494857587, -351090627, -415770042, -844950508, -502412113, -209945296, 151175898, -396187151, 422117121, -843937827, 423477241, 392519864, -952002965, -877904131, -636267050, 665135074, -482730743, -572058819, 526987769, 411313096, 725564911, -651075973, -93410646, -705611753, 682597025, 19529432, 434531994, -41935968, 984729505, 159389965, -840168605, -65725882, 835137053, 213505986, 60801074, 660771285, -986337096, 399585053, 762342802, -514158588, -173290979, -346749824, 285552462, 947598373, 959258847, 23388479, 635976916, 175988284, 959370025, -528569099, -676231948, 249517867, -521467960, -701745551, 662963300, 875386496, 151105611, 571229680, 148256215, -437341342, 663878329, 333579632, -318548139, 351570913, 893005235, -747248962, -964941843, 220020827, -71864239, 83406954, -76603201, 142949703, 413082608, 797617771, -617154415, -802462808, -876301994, -592016699, 573893541, 914569063, 999817887, 821958339, 671900543, 672095441, -568101699, 355742912, 228538775, 108021471, -709816323, -33785657, 725849636, -914653466, 831519730, -183900394, -466602528, -401677235, -400356132, -173113878, -520519353, 834586306, -357666789, -357408308, -311300156, -516061759, 2112235, 566800647, 672146018, 456309769, 538872126, 404008157, 381043078, 353359695, 502566673, 197063308, -668327695, 897504942, -535381678, 539895490, -784960201, -385332227, -827493964, -869377970, -263421527, -177891340
     };
 
-    /* Get and print stats for built-in quicksort. */
-    printf("Built-in quicksort\n");
-    start = clock();
+    /* Create the input shapes from the random integers. The second copy of the
+     * random integers becomes the sorted input and the expected result of the
+     * unsorted and reverse sorted inputs.
+     */
     qsort(arr2, ARRLEN, sizeof (int), cmp);
-    diff = clock() - start;
-    diffinmsec = diff * 1000 / CLOCKS_PER_SEC;
-    printf("%lu compares\n", cmpcount);
-    printf("Time taken %d seconds %d milliseconds\n", diffinmsec / 1000, diffinmsec % 1000);
-    printf("\n");
+    for (shape = 0; shape < SHAPECOUNT; shape++) {
+        shapes[shape] = (int *)malloc(ARRLEN * sizeof (int));
+        assert(shapes[shape]);
+    }
+    work = (int *)malloc(ARRLEN * sizeof (int));
+    assert(work);
+    memcpy(shapes[0], arr1, ARRLEN * sizeof (int));
+    memcpy(shapes[1], arr2, ARRLEN * sizeof (int));
+    for (i = 0; i < ARRLEN; i++) {
+        shapes[2][i] = arr2[ARRLEN - 1 - i];
+        shapes[3][i] = 5;
+    }
 
-    /* Get and print stats for implemented sort. */
-    /* Reset comparison count. */
-    cmpcount = 0;
-    printf("Implemented sort\n");
-    start = clock();
-    sort_quicksort(arr1, ARRLEN, sizeof (int), cmp);
-    diff = clock() - start;
-    diffinmsec = diff * 1000 / CLOCKS_PER_SEC;
-    printf("%lu compares\n", cmpcount);
-    printf("Time taken %d seconds %d milliseconds\n", diffinmsec / 1000, diffinmsec % 1000);
-    printf("\n");
+    /* Open the hardware performance counters if the machine permits them. */
+    if (!perfcount_open(&pc)) {
+        printf("Performance counters unavailable\n");
+        printf("\n");
+    }
+
+    /* Get and print stats for each algorithm on each input shape. */
+    for (shape = 0; shape < SHAPECOUNT; shape++) {
+        printf("Test %d - %s\n", shape + 1, shapenames[shape]);
+        printf("\n");
+
+        for (ialgorithm = 0; ialgorithm < sizeof (algorithms) / sizeof (algorithms[0]); ialgorithm++) {
+            memcpy(work, shapes[shape], ARRLEN * sizeof (int));
+
+            /* Reset comparison count. */
+            cmpcount = 0;
+            printf("%s\n", algorithms[ialgorithm].name);
+            perfcount_start(&pc);
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            algorithms[ialgorithm].sort(work, ARRLEN, sizeof (int), algorithms[ialgorithm].isparallel ? cmpuncounted : cmp);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            perfcount_stop(&pc);
+            diffinmsec = (end.tv_sec - start.tv_sec) * 1000 + (end.tv_nsec - start.tv_nsec) / 1000000;
+            if (algorithms[ialgorithm].isparallel) {
+                printf("Compares not counted\n");
+            } else {
+                printf("%lu compares\n", cmpcount);
+            }
+            printf("Time taken %ld seconds %ld milliseconds\n", diffinmsec / 1000, diffinmsec % 1000);
+            for (j = 0; j < PERFCOUNT_COUNT && algorithms[ialgorithm].iscounted; j++) {
+                if (pc.fds[j] >= 0) {
+                    printf("%lu %s\n", pc.values[j], perfcount_names[j]);
+                }
+            }
+            printf("\n");
+
+            /* Check if sort is correct. */
+            assert(array_issorted(work, ARRLEN));
+            for (i = 0; i < ARRLEN; i++) {
+                tmp = shape == 3 ? 5 : arr2[i];
+                assert(work[i] == tmp);
+            }
+        }
+    }
 
-    /* Check if sort is correct. */
-    assert(array_issorted(arr1, ARRLEN));
+    /* Check the sorts with other interfaces. */
+    test_columns(arr1, arr2, ARRLEN);
+    test_group_count(arr1, ARRLEN);
+    for (i = 0; i < ARRLEN; i++) {
+        work[i] = arr1[i] % 100;
+    }
+    test_group_count(work, ARRLEN);
+    test_group_count(shapes[3], ARRLEN);
+    test_counting(shapes[3], ARRLEN, SORT_COUNTING_NONE);
+    test_counting(work, ARRLEN, SORT_COUNTING_COUNTING);
     for (i = 0; i < ARRLEN; i++) {
-        assert(arr1[i] == arr2[i]);
+        work[i] = arr1[i] / 1000;
+    }
+    test_counting(work, ARRLEN, SORT_COUNTING_BUCKET);
+    test_counting(arr1, ARRLEN, SORT_COUNTING_MERGESORT);
+    test_samplesort(arr1, ARRLEN);
+
+    perfcount_close(&pc);
+    sort_executor_shutdown();
+    for (shape = 0; shape < SHAPECOUNT; shape++) {
+        free(shapes[shape]);
     }
+    free(work);
 
     return 0;
 }
@@ -0,0 +1,149 @@
+/*
+ * perfcount.c
+ * Version 20261019
+ * Written by Harry Wong (RedAndBlueEraser)
+ *
+ * Hardware performance counters with Linux perf_event_open. On other systems,
+ * or when the kernel does not permit them, every counter is unavailable.
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+#include "perfcount.h"
+
+const char *perfcount_names[PERFCOUNT_COUNT] = {
+    "cycles",
+    "instructions",
+    "L1 data cache misses",
+    "last level cache misses",
+    "branch mispredictions",
+    "data TLB misses"
+};
+
+#ifdef __linux__
+
+/* Types and configurations of the hardware performance counters, in the same
+ * order as their names.
+ */
+static const unsigned long perfcount_types[PERFCOUNT_COUNT] = {
+    PERF_TYPE_HARDWARE,
+    PERF_TYPE_HARDWARE,
+    PERF_TYPE_HW_CACHE,
+    PERF_TYPE_HW_CACHE,
+    PERF_TYPE_HARDWARE,
+    PERF_TYPE_HW_CACHE
+};
+static const unsigned long perfcount_configs[PERFCOUNT_COUNT] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_BRANCH_MISSES,
+    PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+};
+
+int perfcount_open(struct perfcount *pc) {
+    struct perf_event_attr attr;
+    int i, available = 0;
+
+    /* Open each counter on its own, so that a counter the machine does not
+     * support does not take the others with it. Only user space is counted, so
+     * that counters are permitted at the default paranoia level. Threads
+     * created while counting are counted too, once they are joined.
+     */
+    for (i = 0; i < PERFCOUNT_COUNT; i++) {
+        memset(&attr, 0, sizeof (attr));
+        attr.size = sizeof (attr);
+        attr.type = perfcount_types[i];
+        attr.config = perfcount_configs[i];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.inherit = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        pc->fds[i] = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        pc->values[i] = 0;
+        if (pc->fds[i] >= 0) {
+            available++;
+        }
+    }
+
+    return available;
+}
+
+void perfcount_start(struct perfcount *pc) {
+    int i;
+
+    for (i = 0; i < PERFCOUNT_COUNT; i++) {
+        if (pc->fds[i] >= 0) {
+            ioctl(pc->fds[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(pc->fds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+void perfcount_stop(struct perfcount *pc) {
+    __u64 buf[3];  /* Value, time enabled and time running. */
+    int i;
+
+    for (i = 0; i < PERFCOUNT_COUNT; i++) {
+        if (pc->fds[i] >= 0) {
+            ioctl(pc->fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    /* Read the values, scaling them up if the kernel had to multiplex more
+     * counters than the machine has.
+     */
+    for (i = 0; i < PERFCOUNT_COUNT; i++) {
+        pc->values[i] = 0;
+        if (pc->fds[i] >= 0 && read(pc->fds[i], buf, sizeof (buf)) == sizeof (buf)) {
+            if (buf[2] > 0 && buf[2] < buf[1]) {
+                pc->values[i] = (unsigned long)((double)buf[0] * buf[1] / buf[2]);
+            } else {
+                pc->values[i] = (unsigned long)buf[0];
+            }
+        }
+    }
+}
+
+void perfcount_close(struct perfcount *pc) {
+    int i;
+
+    for (i = 0; i < PERFCOUNT_COUNT; i++) {
+        if (pc->fds[i] >= 0) {
+            close(pc->fds[i]);
+            pc->fds[i] = -1;
+        }
+    }
+}
+
+#else
+
+int perfcount_open(struct perfcount *pc) {
+    int i;
+
+    for (i = 0; i < PERFCOUNT_COUNT; i++) {
+        pc->fds[i] = -1;
+        pc->values[i] = 0;
+    }
+
+    return 0;
+}
+
+void perfcount_start(struct perfcount *pc) {
+}
+
+void perfcount_stop(struct perfcount *pc) {
+}
+
+void perfcount_close(struct perfcount *pc) {
+}
+
+#endif
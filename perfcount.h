@@ -0,0 +1,39 @@
+/*
+ * perfcount.h
+ * Version 20261019
+ * Written by Harry Wong (RedAndBlueEraser)
+ */
+
+#ifndef PERFCOUNT_H
+#define PERFCOUNT_H
+
+/* Number of hardware performance counters. */
+#define PERFCOUNT_COUNT 6
+
+/* Hardware performance counters of the calling thread and the threads it
+ * creates.
+ */
+struct perfcount {
+    int fds[PERFCOUNT_COUNT];                  /* File descriptors of counters, or -1 if unavailable. */
+    unsigned long values[PERFCOUNT_COUNT];     /* Values counted between last start and stop. */
+};
+
+/* Names of the hardware performance counters. */
+extern const char *perfcount_names[PERFCOUNT_COUNT];
+
+/* Open the hardware performance counters. Counters that are not supported by
+ * the machine or not permitted are marked unavailable. Returns the number of
+ * available counters.
+ */
+int perfcount_open(struct perfcount *pc);
+
+/* Reset and start the available hardware performance counters. */
+void perfcount_start(struct perfcount *pc);
+
+/* Stop the available hardware performance counters and read their values. */
+void perfcount_stop(struct perfcount *pc);
+
+/* Close the hardware performance counters. */
+void perfcount_close(struct perfcount *pc);
+
+#endif
@@ -1,13 +1,17 @@
 /*
  * sort.c
- * Version 20170803
+ * Version 20261019
  * Written by Harry Wong (RedAndBlueEraser)
  */
 
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "sort.h"
+#ifdef SORT_TUNING
+#include "sort_tuning.h"
+#endif
 
 #define FALSE 0
 #define TRUE !FALSE
@@ -15,6 +19,77 @@
 #define SORT_QUICKSORT_INSSORTTHRES 8
 #define SORT_SHELLSORT_GAPSEQ { 40423, 17966, 7985, 3549, 1577, 701, 301, 132, 57, 23, 10, 4, 1 }
 #define SORT_SHELLSORT_GAPSEQ_COUNT 13
+#define SORT_COUNTING_RANGERATIO 2
+#define SORT_COUNTING_BUCKETRANGERATIO 64
+#define SORT_COUNTING_INSSORTTHRES 16
+#define SORT_MERGESORT_TYPED_RUNLEN 16
+
+/* Use SSE4.1 and AVX2 merges for ints and longs if the compiler can target them
+ * and the types have the widths of the vector lanes. The processor is checked
+ * for support at run time.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#if INT_MAX == 2147483647
+#define SORT_MERGESORT_SIMD_INT
+#endif
+#if (LONG_MAX >> 31) >> 31 == 1
+#define SORT_MERGESORT_SIMD_LONG
+#endif
+#endif
+
+/* Tuning parameters of every element size class. The generated sort_tuning.h
+ * (see `make tune`) may define per-machine parameters, otherwise every class
+ * uses the parameters defined above.
+ */
+#ifndef SORT_TUNING_TABLE
+#define SORT_TUNING_DEFAULT { SORT_QUICKSORT_INSSORTTHRES, SORT_COMBSORT_SHRINKFACTOR, SORT_SHELLSORT_GAPSEQ, SORT_SHELLSORT_GAPSEQ_COUNT }
+#define SORT_TUNING_TABLE { SORT_TUNING_DEFAULT, SORT_TUNING_DEFAULT, SORT_TUNING_DEFAULT, SORT_TUNING_DEFAULT }
+#endif
+
+static const size_t sort_tuningclassmaxsizes[] = SORT_TUNING_CLASSMAXSIZES;
+static const struct sort_tuning sort_tuningdefaults[SORT_TUNING_CLASSCOUNT] = SORT_TUNING_TABLE;
+static struct sort_tuning sort_tunings[SORT_TUNING_CLASSCOUNT] = SORT_TUNING_TABLE;
+
+/* Get the index of the element size class of the element size. */
+static size_t sort_tuning_class(size_t elesize) {
+    size_t i = 0;
+    while (i < SORT_TUNING_CLASSCOUNT - 1 && elesize > sort_tuningclassmaxsizes[i]) {
+        i++;
+    }
+    return i;
+}
+
+void sort_gettuning(size_t elesize, struct sort_tuning *tuning) {
+    *tuning = sort_tunings[sort_tuning_class(elesize)];
+}
+
+int sort_settuning(size_t elesize, const struct sort_tuning *tuning) {
+    size_t i;
+
+    /* Reject parameters that would make the sorting algorithms loop forever or
+     * run over the gap sequence. The gap sequence must be strictly descending
+     * and end with 1.
+     */
+    if (!(tuning->combsortshrinkfactor > 1.0)
+        || tuning->shellsortgapseqcount == 0
+        || tuning->shellsortgapseqcount > SORT_TUNING_GAPSEQ_MAX
+        || tuning->shellsortgapseq[tuning->shellsortgapseqcount - 1] != 1) {
+        return -1;
+    }
+    for (i = 1; i < tuning->shellsortgapseqcount; i++) {
+        if (tuning->shellsortgapseq[i - 1] <= tuning->shellsortgapseq[i]) {
+            return -1;
+        }
+    }
+
+    sort_tunings[sort_tuning_class(elesize)] = *tuning;
+    return 0;
+}
+
+void sort_resettuning(void) {
+    memcpy(sort_tunings, sort_tuningdefaults, sizeof (sort_tunings));
+}
 
 /* Swap the specified amount of bytes between two memory areas. */
 static void memswap(void *ptr1, void *ptr2, size_t len) {
@@ -160,6 +235,7 @@ void sort_combsort(void *arr, size_t count, size_t elesize, int (*cmp)(const voi
         *ptr2,                                 /* Pointer to second element to be compared. */
         issorted = !count;                     /* Boolean flag whether array is sorted. */
     size_t gap = count;                        /* Distance between elements to be compared. */
+    double shrinkfactor = sort_tunings[sort_tuning_class(elesize)].combsortshrinkfactor;  /* Factor to shrink gap by. */
 
     /* Iterate until the entire array is sorted. */
     while (!issorted) {
@@ -167,7 +243,7 @@ void sort_combsort(void *arr, size_t count, size_t elesize, int (*cmp)(const voi
         /* Flag whether the array is sorted. If the gap is greater than 1, or a
          * swap occurs, the array is not sorted.
          */
-        gap /= SORT_COMBSORT_SHRINKFACTOR;
+        gap /= shrinkfactor;
         if (gap <= 1) {
             issorted = TRUE;
             gap = 1;
@@ -317,7 +393,7 @@ void sort_quicksort(void *arr, size_t count, size_t elesize, int (*cmp)(const vo
     }
 
     /* Sort array with insertion sort if array has few elements. */
-    if (count <= SORT_QUICKSORT_INSSORTTHRES) {
+    if (count <= sort_tunings[sort_tuning_class(elesize)].quicksortinssortthres) {
         sort_insertionsort(arr, count, elesize, cmp);
         return;
     }
@@ -333,6 +409,84 @@ void sort_quicksort(void *arr, size_t count, size_t elesize, int (*cmp)(const vo
     sort_quicksort(ptrfirstgt, count - ifirstgt, elesize, cmp);
 }
 
+static size_t sort_quicksort_unique(void *arr, size_t count, size_t elesize, int (*cmp)(const void *, const void *), size_t *counts) {
+    char *ptrstart = (char *)arr,              /* Pointer to start of array. */
+        *ptrend = ptrstart + count * elesize,  /* Pointer to end of array. */
+        *ptrcurr,                              /* Pointer to element to be compared. */
+        *ptrunique,                            /* Pointer to last distinct element. */
+        *ptrfirstgt;                           /* Pointer to first element in greater than partition of array. */
+    size_t ifirsteq,                           /* Index of first element in equal to partition of array. */
+        ifirstgt,                              /* Index of first element in greater than partition of array. */
+        nless,                                 /* Number of distinct elements in less than partition of array. */
+        ngt;                                   /* Number of distinct elements in greater than partition of array. */
+
+    if (count == 0) {
+        return 0;
+    }
+
+    /* Sort array with insertion sort if array has few elements, and then
+     * collapse each run of equal elements into its first element.
+     */
+    if (count <= sort_tunings[sort_tuning_class(elesize)].quicksortinssortthres) {
+        sort_insertionsort(arr, count, elesize, cmp);
+        ptrunique = ptrstart;
+        if (counts) {
+            counts[0] = 1;
+        }
+        for (ptrcurr = ptrstart + elesize; ptrcurr < ptrend; ptrcurr += elesize) {
+            if (cmp(ptrunique, ptrcurr) == 0) {
+                if (counts) {
+                    counts[(ptrunique - ptrstart) / elesize]++;
+                }
+            } else {
+                ptrunique += elesize;
+                if (ptrunique != ptrcurr) {
+                    memcpy(ptrunique, ptrcurr, elesize);
+                }
+                if (counts) {
+                    counts[(ptrunique - ptrstart) / elesize] = 1;
+                }
+            }
+        }
+        return (ptrunique - ptrstart) / elesize + 1;
+    }
+
+    /* Partition array into three partitions - less than, equal to, and greater
+     * than partitions. The elements in the equal to partition are never looked
+     * at again.
+     */
+    sort_quicksort_partition(arr, count, elesize, cmp, &ptrfirstgt, &ifirsteq, &ifirstgt);
+
+    /* Recursively collapse the less than partition of the array, which leaves
+     * its distinct elements at the start of the array. Move one element of the
+     * equal to partition right after them.
+     */
+    nless = sort_quicksort_unique(arr, ifirsteq, elesize, cmp, counts);
+    ptrunique = ptrstart + nless * elesize;
+    if (nless != ifirsteq) {
+        memcpy(ptrunique, ptrstart + ifirsteq * elesize, elesize);
+    }
+    if (counts) {
+        counts[nless] = ifirstgt - ifirsteq;
+    }
+
+    /* Recursively collapse the greater than partition of the array, and move
+     * its distinct elements right after the element of the equal to partition.
+     */
+    ngt = sort_quicksort_unique(ptrfirstgt, count - ifirstgt, elesize, cmp, counts ? counts + nless + 1 : NULL);
+    memmove(ptrunique + elesize, ptrfirstgt, ngt * elesize);
+
+    return nless + 1 + ngt;
+}
+
+size_t sort_unique(void *arr, size_t count, size_t elesize, int (*cmp)(const void *, const void *)) {
+    return sort_quicksort_unique(arr, count, elesize, cmp, NULL);
+}
+
+size_t sort_group_count(void *arr, size_t count, size_t elesize, int (*cmp)(const void *, const void *), size_t *counts) {
+    return sort_quicksort_unique(arr, count, elesize, cmp, counts);
+}
+
 void sort_slowsort(void *arr, size_t count, size_t elesize, int (*cmp)(const void *, const void *)) {
     char *ptrfirst = (char *)arr,  /* Pointer to first element in array. */
         *ptrmiddle,                /* Pointer to middle element in array. */
@@ -526,16 +680,17 @@ void sort_insertionsort(void *arr, size_t count, size_t elesize, int (*cmp)(cons
 }
 
 void sort_shellsort(void *arr, size_t count, size_t elesize, int (*cmp)(const void *, const void *)) {
-    char *ptrstart = (char *)arr,                 /* Pointer to start of array. */
-        *ptrend = ptrstart + count * elesize,     /* Pointer to end of array. */
-        *ptrcurr,                                 /* Pointer to element to be compared. */
-        *ptr1,                                    /* Pointer to first element to be compared. */
-        *ptr2,                                    /* Pointer to second element to be compared. */
-        *ptr2min;                                 /* Pointer to element closest to start of array possible for ptr2 given current gap. */
-    size_t gaps[] = SORT_SHELLSORT_GAPSEQ,        /* Array of gaps in descending order. */
-        gapscount = SORT_SHELLSORT_GAPSEQ_COUNT,  /* Number of elements in gaps array. */
-        igap,                                     /* Index of current gap in gaps array. */
-        gapsize;                                  /* Number of bytes to increment by current gap. */
+    const struct sort_tuning *tuning = &sort_tunings[sort_tuning_class(elesize)];  /* Tuning parameters for element size. */
+    char *ptrstart = (char *)arr,                      /* Pointer to start of array. */
+        *ptrend = ptrstart + count * elesize,          /* Pointer to end of array. */
+        *ptrcurr,                                      /* Pointer to element to be compared. */
+        *ptr1,                                         /* Pointer to first element to be compared. */
+        *ptr2,                                         /* Pointer to second element to be compared. */
+        *ptr2min;                                      /* Pointer to element closest to start of array possible for ptr2 given current gap. */
+    const size_t *gaps = tuning->shellsortgapseq;      /* Array of gaps in descending order. */
+    size_t gapscount = tuning->shellsortgapseqcount,   /* Number of elements in gaps array. */
+        igap,                                          /* Index of current gap in gaps array. */
+        gapsize;                                       /* Number of bytes to increment by current gap. */
 
     /* Get the largest gap from the gap sequence that is smaller than the number
      * of elements in the array. If there are no elements in the array, run over
@@ -640,3 +795,597 @@ void sort_mergesort(void *arr, size_t count, size_t elesize, int (*cmp)(const vo
         sort_mergesort_merge(arr, ndivide2, nlessndivide2, elesize, cmp);
     }
 }
+
+/* Sort a short array of ints with insertion sort. */
+static void sort_mergesort_int_runsort(void *arr, size_t count) {
+    int *ptrstart = (int *)arr,         /* Pointer to start of array. */
+        *ptrend = ptrstart + count,     /* Pointer to end of array. */
+        *ptrcurr,                       /* Pointer to element to be inserted. */
+        *ptr,                           /* Pointer to position to be written. */
+        tmp;                            /* Copy of element to be inserted. */
+
+    for (ptrcurr = ptrstart + 1; ptrcurr < ptrend; ptrcurr++) {
+        tmp = *ptrcurr;
+        for (ptr = ptrcurr; ptr > ptrstart && ptr[-1] > tmp; ptr--) {
+            *ptr = ptr[-1];
+        }
+        *ptr = tmp;
+    }
+}
+
+/* Merge two sorted arrays of ints into the output array. The smaller element is
+ * picked by arithmetic rather than a branch, which the processor could not
+ * predict.
+ */
+static void sort_mergesort_int_merge_scalar(const void *arr1, size_t count1, const void *arr2, size_t count2, void *out) {
+    const int *ptr1 = (const int *)arr1,  /* Pointer to element in array 1 to be compared. */
+        *ptr1end = ptr1 + count1,         /* Pointer to end of array 1. */
+        *ptr2 = (const int *)arr2,        /* Pointer to element in array 2 to be compared. */
+        *ptr2end = ptr2 + count2;         /* Pointer to end of array 2. */
+    int *ptrout = (int *)out,             /* Pointer to element to be written. */
+        take2;                            /* Boolean flag whether element from array 2 is smaller. */
+
+    while (ptr1 < ptr1end && ptr2 < ptr2end) {
+        take2 = *ptr2 < *ptr1;
+        *ptrout++ = take2 ? *ptr2 : *ptr1;
+        ptr1 += !take2;
+        ptr2 += take2;
+    }
+
+    /* Copy the remaining elements of either array. */
+    memcpy(ptrout, ptr1, (ptr1end - ptr1) * sizeof (int));
+    memcpy(ptrout + (ptr1end - ptr1), ptr2, (ptr2end - ptr2) * sizeof (int));
+}
+
+/* Merge the sorted elements held back by a vectorised merge with the remaining
+ * elements of the two arrays into the output array.
+ */
+static void sort_mergesort_int_merge_tail(const int *buf, size_t countbuf, const int *ptr1, const int *ptr1end, const int *ptr2, const int *ptr2end, int *ptrout) {
+    const int *ptrbufend = buf + countbuf;  /* Pointer to end of held back elements. */
+
+    /* Copy the smallest of the three next elements until the held back
+     * elements run out, and then merge the rest of the two arrays.
+     */
+    while (buf < ptrbufend) {
+        if (ptr1 < ptr1end && *ptr1 < *buf && (ptr2 == ptr2end || *ptr1 <= *ptr2)) {
+            *ptrout++ = *ptr1++;
+        } else if (ptr2 < ptr2end && *ptr2 < *buf) {
+            *ptrout++ = *ptr2++;
+        } else {
+            *ptrout++ = *buf++;
+        }
+    }
+    sort_mergesort_int_merge_scalar(ptr1, ptr1end - ptr1, ptr2, ptr2end - ptr2, ptrout);
+}
+
+#ifdef SORT_MERGESORT_SIMD_INT
+
+/* Merge two sorted arrays of ints into the output array four elements at a time
+ * with SSE4.1. Each step merges the four largest elements of the last step with
+ * the next four elements of the array with the smaller next element using a
+ * bitonic merging network, and writes out the four smallest.
+ */
+__attribute__((target("sse4.1")))
+static void sort_mergesort_int_merge_sse41(const void *arr1, size_t count1, const void *arr2, size_t count2, void *out) {
+    const int *ptr1 = (const int *)arr1,  /* Pointer to next elements in array 1. */
+        *ptr1end = ptr1 + count1,         /* Pointer to end of array 1. */
+        *ptr2 = (const int *)arr2,        /* Pointer to next elements in array 2. */
+        *ptr2end = ptr2 + count2;         /* Pointer to end of array 2. */
+    int *ptrout = (int *)out,             /* Pointer to elements to be written. */
+        buf[4];                           /* Copy of held back elements. */
+    __m128i lo, hi, tmp, min, max;
+
+    if (count1 < 4 || count2 < 4) {
+        sort_mergesort_int_merge_scalar(arr1, count1, arr2, count2, out);
+        return;
+    }
+
+    lo = _mm_loadu_si128((const __m128i *)ptr1);
+    hi = _mm_loadu_si128((const __m128i *)ptr2);
+    ptr1 += 4;
+    ptr2 += 4;
+    for (;;) {
+        /* Reverse one vector so that both form a bitonic sequence, split it
+         * into the smaller and larger halves, and then sort each half.
+         */
+        hi = _mm_shuffle_epi32(hi, _MM_SHUFFLE(0, 1, 2, 3));
+        min = _mm_min_epi32(lo, hi);
+        max = _mm_max_epi32(lo, hi);
+        lo = min;
+        hi = max;
+
+        tmp = _mm_shuffle_epi32(lo, _MM_SHUFFLE(1, 0, 3, 2));
+        lo = _mm_blend_epi16(_mm_min_epi32(lo, tmp), _mm_max_epi32(lo, tmp), 0xF0);
+        tmp = _mm_shuffle_epi32(hi, _MM_SHUFFLE(1, 0, 3, 2));
+        hi = _mm_blend_epi16(_mm_min_epi32(hi, tmp), _mm_max_epi32(hi, tmp), 0xF0);
+
+        tmp = _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 3, 0, 1));
+        lo = _mm_blend_epi16(_mm_min_epi32(lo, tmp), _mm_max_epi32(lo, tmp), 0xCC);
+        tmp = _mm_shuffle_epi32(hi, _MM_SHUFFLE(2, 3, 0, 1));
+        hi = _mm_blend_epi16(_mm_min_epi32(hi, tmp), _mm_max_epi32(hi, tmp), 0xCC);
+
+        _mm_storeu_si128((__m128i *)ptrout, lo);
+        ptrout += 4;
+
+        /* Load the next four elements of the array with the smaller next
+         * element, until that array runs out.
+         */
+        if (ptr2 == ptr2end || (ptr1 < ptr1end && *ptr1 <= *ptr2)) {
+            if (ptr1end - ptr1 < 4) {
+                break;
+            }
+            lo = _mm_loadu_si128((const __m128i *)ptr1);
+            ptr1 += 4;
+        } else {
+            if (ptr2end - ptr2 < 4) {
+                break;
+            }
+            lo = _mm_loadu_si128((const __m128i *)ptr2);
+            ptr2 += 4;
+        }
+    }
+
+    _mm_storeu_si128((__m128i *)buf, hi);
+    sort_mergesort_int_merge_tail(buf, 4, ptr1, ptr1end, ptr2, ptr2end, ptrout);
+}
+
+/* Merge two sorted arrays of ints into the output array eight elements at a
+ * time with AVX2, the same way as with SSE4.1.
+ */
+__attribute__((target("avx2")))
+static void sort_mergesort_int_merge_avx2(const void *arr1, size_t count1, const void *arr2, size_t count2, void *out) {
+    const int *ptr1 = (const int *)arr1,  /* Pointer to next elements in array 1. */
+        *ptr1end = ptr1 + count1,         /* Pointer to end of array 1. */
+        *ptr2 = (const int *)arr2,        /* Pointer to next elements in array 2. */
+        *ptr2end = ptr2 + count2;         /* Pointer to end of array 2. */
+    int *ptrout = (int *)out,             /* Pointer to elements to be written. */
+        buf[8];                           /* Copy of held back elements. */
+    __m256i lo, hi, tmp, min, max,
+        reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+    if (count1 < 8 || count2 < 8) {
+        sort_mergesort_int_merge_scalar(arr1, count1, arr2, count2, out);
+        return;
+    }
+
+    lo = _mm256_loadu_si256((const __m256i *)ptr1);
+    hi = _mm256_loadu_si256((const __m256i *)ptr2);
+    ptr1 += 8;
+    ptr2 += 8;
+    for (;;) {
+        hi = _mm256_permutevar8x32_epi32(hi, reverse);
+        min = _mm256_min_epi32(lo, hi);
+        max = _mm256_max_epi32(lo, hi);
+        lo = min;
+        hi = max;
+
+        tmp = _mm256_permute2x128_si256(lo, lo, 0x01);
+        lo = _mm256_blend_epi32(_mm256_min_epi32(lo, tmp), _mm256_max_epi32(lo, tmp), 0xF0);
+        tmp = _mm256_permute2x128_si256(hi, hi, 0x01);
+        hi = _mm256_blend_epi32(_mm256_min_epi32(hi, tmp), _mm256_max_epi32(hi, tmp), 0xF0);
+
+        tmp = _mm256_shuffle_epi32(lo, _MM_SHUFFLE(1, 0, 3, 2));
+        lo = _mm256_blend_epi32(_mm256_min_epi32(lo, tmp), _mm256_max_epi32(lo, tmp), 0xCC);
+        tmp = _mm256_shuffle_epi32(hi, _MM_SHUFFLE(1, 0, 3, 2));
+        hi = _mm256_blend_epi32(_mm256_min_epi32(hi, tmp), _mm256_max_epi32(hi, tmp), 0xCC);
+
+        tmp = _mm256_shuffle_epi32(lo, _MM_SHUFFLE(2, 3, 0, 1));
+        lo = _mm256_blend_epi32(_mm256_min_epi32(lo, tmp), _mm256_max_epi32(lo, tmp), 0xAA);
+        tmp = _mm256_shuffle_epi32(hi, _MM_SHUFFLE(2, 3, 0, 1));
+        hi = _mm256_blend_epi32(_mm256_min_epi32(hi, tmp), _mm256_max_epi32(hi, tmp), 0xAA);
+
+        _mm256_storeu_si256((__m256i *)ptrout, lo);
+        ptrout += 8;
+
+        if (ptr2 == ptr2end || (ptr1 < ptr1end && *ptr1 <= *ptr2)) {
+            if (ptr1end - ptr1 < 8) {
+                break;
+            }
+            lo = _mm256_loadu_si256((const __m256i *)ptr1);
+            ptr1 += 8;
+        } else {
+            if (ptr2end - ptr2 < 8) {
+                break;
+            }
+            lo = _mm256_loadu_si256((const __m256i *)ptr2);
+            ptr2 += 8;
+        }
+    }
+
+    _mm256_storeu_si256((__m256i *)buf, hi);
+    sort_mergesort_int_merge_tail(buf, 8, ptr1, ptr1end, ptr2, ptr2end, ptrout);
+}
+
+#endif
+
+/* Sort a short array of longs with insertion sort. */
+static void sort_mergesort_long_runsort(void *arr, size_t count) {
+    long *ptrstart = (long *)arr,       /* Pointer to start of array. */
+        *ptrend = ptrstart + count,     /* Pointer to end of array. */
+        *ptrcurr,                       /* Pointer to element to be inserted. */
+        *ptr,                           /* Pointer to position to be written. */
+        tmp;                            /* Copy of element to be inserted. */
+
+    for (ptrcurr = ptrstart + 1; ptrcurr < ptrend; ptrcurr++) {
+        tmp = *ptrcurr;
+        for (ptr = ptrcurr; ptr > ptrstart && ptr[-1] > tmp; ptr--) {
+            *ptr = ptr[-1];
+        }
+        *ptr = tmp;
+    }
+}
+
+/* Merge two sorted arrays of longs into the output array without branching on
+ * the comparison.
+ */
+static void sort_mergesort_long_merge_scalar(const void *arr1, size_t count1, const void *arr2, size_t count2, void *out) {
+    const long *ptr1 = (const long *)arr1,  /* Pointer to element in array 1 to be compared. */
+        *ptr1end = ptr1 + count1,           /* Pointer to end of array 1. */
+        *ptr2 = (const long *)arr2,         /* Pointer to element in array 2 to be compared. */
+        *ptr2end = ptr2 + count2;           /* Pointer to end of array 2. */
+    long *ptrout = (long *)out;             /* Pointer to element to be written. */
+    int take2;                              /* Boolean flag whether element from array 2 is smaller. */
+
+    while (ptr1 < ptr1end && ptr2 < ptr2end) {
+        take2 = *ptr2 < *ptr1;
+        *ptrout++ = take2 ? *ptr2 : *ptr1;
+        ptr1 += !take2;
+        ptr2 += take2;
+    }
+
+    memcpy(ptrout, ptr1, (ptr1end - ptr1) * sizeof (long));
+    memcpy(ptrout + (ptr1end - ptr1), ptr2, (ptr2end - ptr2) * sizeof (long));
+}
+
+#ifdef SORT_MERGESORT_SIMD_LONG
+
+/* Merge the sorted elements held back by a vectorised merge with the remaining
+ * elements of the two arrays into the output array.
+ */
+static void sort_mergesort_long_merge_tail(const long *buf, size_t countbuf, const long *ptr1, const long *ptr1end, const long *ptr2, const long *ptr2end, long *ptrout) {
+    const long *ptrbufend = buf + countbuf;  /* Pointer to end of held back elements. */
+
+    while (buf < ptrbufend) {
+        if (ptr1 < ptr1end && *ptr1 < *buf && (ptr2 == ptr2end || *ptr1 <= *ptr2)) {
+            *ptrout++ = *ptr1++;
+        } else if (ptr2 < ptr2end && *ptr2 < *buf) {
+            *ptrout++ = *ptr2++;
+        } else {
+            *ptrout++ = *buf++;
+        }
+    }
+    sort_mergesort_long_merge_scalar(ptr1, ptr1end - ptr1, ptr2, ptr2end - ptr2, ptrout);
+}
+
+/* Merge two sorted arrays of longs into the output array four elements at a
+ * time with AVX2, the same way as for ints. AVX2 has no 64-bit minimum and
+ * maximum, so they are made from a comparison and blends.
+ */
+__attribute__((target("avx2")))
+static void sort_mergesort_long_merge_avx2(const void *arr1, size_t count1, const void *arr2, size_t count2, void *out) {
+    const long *ptr1 = (const long *)arr1,  /* Pointer to next elements in array 1. */
+        *ptr1end = ptr1 + count1,           /* Pointer to end of array 1. */
+        *ptr2 = (const long *)arr2,         /* Pointer to next elements in array 2. */
+        *ptr2end = ptr2 + count2;           /* Pointer to end of array 2. */
+    long *ptrout = (long *)out,             /* Pointer to elements to be written. */
+        buf[4];                             /* Copy of held back elements. */
+    __m256i lo, hi, tmp, gt, min, max;
+
+    if (count1 < 4 || count2 < 4) {
+        sort_mergesort_long_merge_scalar(arr1, count1, arr2, count2, out);
+        return;
+    }
+
+    lo = _mm256_loadu_si256((const __m256i *)ptr1);
+    hi = _mm256_loadu_si256((const __m256i *)ptr2);
+    ptr1 += 4;
+    ptr2 += 4;
+    for (;;) {
+        hi = _mm256_permute4x64_epi64(hi, _MM_SHUFFLE(0, 1, 2, 3));
+        gt = _mm256_cmpgt_epi64(lo, hi);
+        min = _mm256_blendv_epi8(lo, hi, gt);
+        max = _mm256_blendv_epi8(hi, lo, gt);
+        lo = min;
+        hi = max;
+
+        tmp = _mm256_permute4x64_epi64(lo, _MM_SHUFFLE(1, 0, 3, 2));
+        gt = _mm256_cmpgt_epi64(lo, tmp);
+        lo = _mm256_blend_epi32(_mm256_blendv_epi8(lo, tmp, gt), _mm256_blendv_epi8(tmp, lo, gt), 0xF0);
+        tmp = _mm256_permute4x64_epi64(hi, _MM_SHUFFLE(1, 0, 3, 2));
+        gt = _mm256_cmpgt_epi64(hi, tmp);
+        hi = _mm256_blend_epi32(_mm256_blendv_epi8(hi, tmp, gt), _mm256_blendv_epi8(tmp, hi, gt), 0xF0);
+
+        tmp = _mm256_shuffle_epi32(lo, _MM_SHUFFLE(1, 0, 3, 2));
+        gt = _mm256_cmpgt_epi64(lo, tmp);
+        lo = _mm256_blend_epi32(_mm256_blendv_epi8(lo, tmp, gt), _mm256_blendv_epi8(tmp, lo, gt), 0xCC);
+        tmp = _mm256_shuffle_epi32(hi, _MM_SHUFFLE(1, 0, 3, 2));
+        gt = _mm256_cmpgt_epi64(hi, tmp);
+        hi = _mm256_blend_epi32(_mm256_blendv_epi8(hi, tmp, gt), _mm256_blendv_epi8(tmp, hi, gt), 0xCC);
+
+        _mm256_storeu_si256((__m256i *)ptrout, lo);
+        ptrout += 4;
+
+        if (ptr2 == ptr2end || (ptr1 < ptr1end && *ptr1 <= *ptr2)) {
+            if (ptr1end - ptr1 < 4) {
+                break;
+            }
+            lo = _mm256_loadu_si256((const __m256i *)ptr1);
+            ptr1 += 4;
+        } else {
+            if (ptr2end - ptr2 < 4) {
+                break;
+            }
+            lo = _mm256_loadu_si256((const __m256i *)ptr2);
+            ptr2 += 4;
+        }
+    }
+
+    _mm256_storeu_si256((__m256i *)buf, hi);
+    sort_mergesort_long_merge_tail(buf, 4, ptr1, ptr1end, ptr2, ptr2end, ptrout);
+}
+
+#endif
+
+static void sort_mergesort_typed(void *arr, size_t count, size_t elesize, void (*runsort)(void *, size_t), void (*merge)(const void *, size_t, const void *, size_t, void *)) {
+    char *ptrstart = (char *)arr,           /* Pointer to start of array. */
+        *tmp,                               /* Array to merge into. */
+        *src = ptrstart,                    /* Array of runs to be merged. */
+        *dst,                               /* Array of merged runs. */
+        *swap;                              /* Pointer used to swap arrays. */
+    size_t runlen,                          /* Number of elements in each sorted run. */
+        i,                                  /* Index of first element in run. */
+        count1,                             /* Number of elements in first run. */
+        count2;                             /* Number of elements in second run. */
+
+    /* The array is sorted if there are one or fewer elements in the array. */
+    if (count <= 1) {
+        return;
+    }
+
+    /* Sort short runs of the array with insertion sort. */
+    for (i = 0; i < count; i += SORT_MERGESORT_TYPED_RUNLEN) {
+        runsort(ptrstart + i * elesize, count - i < SORT_MERGESORT_TYPED_RUNLEN ? count - i : SORT_MERGESORT_TYPED_RUNLEN);
+    }
+    if (count <= SORT_MERGESORT_TYPED_RUNLEN) {
+        return;
+    }
+
+    tmp = (char *)malloc(count * elesize);
+    if (!tmp) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+
+    /* Merge pairs of runs back and forth between the array and the copy,
+     * doubling the length of runs each time, until one run is left.
+     */
+    dst = tmp;
+    for (runlen = SORT_MERGESORT_TYPED_RUNLEN; runlen < count; runlen *= 2) {
+        for (i = 0; i < count; i += count1 + count2) {
+            count1 = count - i < runlen ? count - i : runlen;
+            count2 = count - i - count1 < runlen ? count - i - count1 : runlen;
+            merge(src + i * elesize, count1, src + (i + count1) * elesize, count2, dst + i * elesize);
+        }
+        swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    /* Copy the sorted array back if it ended up in the copy. */
+    if (src != ptrstart) {
+        memcpy(ptrstart, src, count * elesize);
+    }
+
+    free(tmp);
+}
+
+void sort_mergesort_int(int *arr, size_t count) {
+    void (*merge)(const void *, size_t, const void *, size_t, void *) = sort_mergesort_int_merge_scalar;
+
+    /* Choose the widest merge the processor supports on each call, rather than
+     * caching it, so that threads sorting at the same time do not race.
+     */
+#ifdef SORT_MERGESORT_SIMD_INT
+    if (__builtin_cpu_supports("avx2")) {
+        merge = sort_mergesort_int_merge_avx2;
+    } else if (__builtin_cpu_supports("sse4.1")) {
+        merge = sort_mergesort_int_merge_sse41;
+    }
+#endif
+
+    sort_mergesort_typed(arr, count, sizeof (int), sort_mergesort_int_runsort, merge);
+}
+
+void sort_mergesort_long(long *arr, size_t count) {
+    void (*merge)(const void *, size_t, const void *, size_t, void *) = sort_mergesort_long_merge_scalar;
+
+#ifdef SORT_MERGESORT_SIMD_LONG
+    if (__builtin_cpu_supports("avx2")) {
+        merge = sort_mergesort_long_merge_avx2;
+    }
+#endif
+
+    sort_mergesort_typed(arr, count, sizeof (long), sort_mergesort_long_runsort, merge);
+}
+
+void sort_columns(void *keys, size_t count, size_t keysize, int (*cmp)(const void *, const void *), void *cols[], const size_t colsizes[], size_t colcount) {
+    size_t keyssize = (keysize + sizeof (size_t) - 1) / sizeof (size_t) * sizeof (size_t),  /* Number of bytes of key in record, padded to align index. */
+        recsize = keyssize + sizeof (size_t),  /* Number of bytes of record. */
+        *perm,                                 /* Array of indices of elements to be moved to each position. */
+        tmpsize = 0,                           /* Number of bytes of one element of every column. */
+        i,                                     /* Index of record, and then, start of cycle in permutation. */
+        icurr,                                 /* Index of position to be written in cycle. */
+        inext,                                 /* Index of element to be moved to current position in cycle. */
+        icol;                                  /* Index of column. */
+    char *recs,                                /* Array of records of key followed by its original index. */
+        *ptrrec,                               /* Pointer to record. */
+        *ptrkey = (char *)keys,                /* Pointer to key to be written. */
+        *tmp,                                  /* Copy of one element of every column. */
+        *ptrtmp;                               /* Pointer to element of column in copy. */
+
+    if (count <= 1) {
+        return;
+    }
+
+    /* Copy each key into a record followed by its original index. The key is
+     * at the start of the record, so the comparison function can compare
+     * records as keys.
+     */
+    for (icol = 0; icol < colcount; icol++) {
+        tmpsize += colsizes[icol];
+    }
+    recs = (char *)malloc(count * recsize);
+    tmp = (char *)malloc(tmpsize ? tmpsize : 1);
+    if (!recs || !tmp) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (i = 0, ptrrec = recs; i < count; i++, ptrrec += recsize, ptrkey += keysize) {
+        memcpy(ptrrec, ptrkey, keysize);
+        memcpy(ptrrec + keyssize, &i, sizeof (size_t));
+    }
+
+    /* Sort the records with merge sort, keeping the order of equal keys. */
+    sort_mergesort(recs, count, recsize, cmp);
+
+    /* Copy the sorted keys back to the key column, and collect the original
+     * indices into the permutation at the start of the records array. The n'th
+     * index is written no further than the start of the n'th record, which has
+     * already been read.
+     */
+    perm = (size_t *)recs;
+    for (i = 0, ptrrec = recs, ptrkey = (char *)keys; i < count; i++, ptrrec += recsize, ptrkey += keysize) {
+        memcpy(ptrkey, ptrrec, keysize);
+        memcpy(&inext, ptrrec + keyssize, sizeof (size_t));
+        perm[i] = inext;
+    }
+
+    /* Apply the permutation to every column in place by following each cycle
+     * of the permutation once. The first element of the cycle is copied aside,
+     * each position is then filled with the element to be moved there, and the
+     * last position is filled with the copy. Visited positions are marked by
+     * pointing them to themselves.
+     */
+    for (i = 0; i < count && colcount > 0; i++) {
+        if (perm[i] == i) {
+            continue;
+        }
+
+        for (icol = 0, ptrtmp = tmp; icol < colcount; ptrtmp += colsizes[icol], icol++) {
+            memcpy(ptrtmp, (char *)cols[icol] + i * colsizes[icol], colsizes[icol]);
+        }
+
+        for (icurr = i; (inext = perm[icurr]) != i; icurr = inext) {
+            for (icol = 0; icol < colcount; icol++) {
+                memcpy((char *)cols[icol] + icurr * colsizes[icol], (char *)cols[icol] + inext * colsizes[icol], colsizes[icol]);
+            }
+            perm[icurr] = icurr;
+        }
+
+        for (icol = 0, ptrtmp = tmp; icol < colcount; ptrtmp += colsizes[icol], icol++) {
+            memcpy((char *)cols[icol] + icurr * colsizes[icol], ptrtmp, colsizes[icol]);
+        }
+        perm[icurr] = icurr;
+    }
+
+    free(recs);
+    free(tmp);
+}
+
+int sort_counting(void *arr, size_t count, size_t elesize, int (*cmp)(const void *, const void *), long (*key)(const void *)) {
+    char *ptrstart = (char *)arr,              /* Pointer to start of array. */
+        *ptrend = ptrstart + count * elesize,  /* Pointer to end of array. */
+        *ptr,                                  /* Pointer to element. */
+        *tmp;                                  /* Array of elements in bucket order. */
+    long keymin,                               /* Smallest key. */
+        keymax,                                /* Largest key. */
+        k;                                     /* Key of element. */
+    unsigned long range,                       /* Difference between largest and smallest keys. */
+        width;                                 /* Number of keys in each bucket. */
+    size_t nbuckets,                           /* Number of buckets. */
+        *starts,                               /* Array of indices of first element in each bucket, and then, past last element in each bucket. */
+        ibucket,                               /* Index of bucket. */
+        ifirst;                                /* Index of first element in bucket. */
+    int path;                                  /* Path taken to sort array. */
+
+    if (count <= 1) {
+        return SORT_COUNTING_NONE;
+    }
+
+    /* Find the smallest and largest keys. */
+    keymin = keymax = key(ptrstart);
+    for (ptr = ptrstart + elesize; ptr < ptrend; ptr += elesize) {
+        k = key(ptr);
+        if (k < keymin) {
+            keymin = k;
+        } else if (k > keymax) {
+            keymax = k;
+        }
+    }
+
+    /* Choose the path by the range of keys relative to the number of elements.
+     * Count each key if there are few possible keys, put the elements in
+     * buckets of several keys if there are more, and otherwise fall back to
+     * merge sort.
+     */
+    range = (unsigned long)keymax - (unsigned long)keymin;
+    if (range == 0) {
+        return SORT_COUNTING_NONE;
+    } else if (range / SORT_COUNTING_RANGERATIO < count) {
+        path = SORT_COUNTING_COUNTING;
+        nbuckets = range + 1;
+        width = 1;
+    } else if (range / SORT_COUNTING_BUCKETRANGERATIO < count) {
+        path = SORT_COUNTING_BUCKET;
+        nbuckets = count;
+        width = range / nbuckets + 1;
+    } else {
+        sort_mergesort(arr, count, elesize, cmp);
+        return SORT_COUNTING_MERGESORT;
+    }
+
+    starts = (size_t *)calloc(nbuckets + 1, sizeof (size_t));
+    tmp = (char *)malloc(count * elesize);
+    if (!starts || !tmp) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+
+    /* Count the elements in each bucket, and then sum the counts to get the
+     * index of the first element in each bucket.
+     */
+    for (ptr = ptrstart; ptr < ptrend; ptr += elesize) {
+        starts[((unsigned long)key(ptr) - (unsigned long)keymin) / width + 1]++;
+    }
+    for (ibucket = 1; ibucket < nbuckets; ibucket++) {
+        starts[ibucket] += starts[ibucket - 1];
+    }
+
+    /* Copy each element to the end of its bucket in order, keeping the order of
+     * equal elements. Afterwards, each bucket index points past the last
+     * element in the bucket.
+     */
+    for (ptr = ptrstart; ptr < ptrend; ptr += elesize) {
+        ibucket = ((unsigned long)key(ptr) - (unsigned long)keymin) / width;
+        memcpy(tmp + starts[ibucket]++ * elesize, ptr, elesize);
+    }
+    memcpy(arr, tmp, count * elesize);
+
+    /* Sort each bucket of several keys with insertion sort, or with merge sort
+     * if it has many elements.
+     */
+    if (path == SORT_COUNTING_BUCKET) {
+        for (ibucket = 0, ifirst = 0; ibucket < nbuckets; ifirst = starts[ibucket++]) {
+            if (starts[ibucket] - ifirst <= SORT_COUNTING_INSSORTTHRES) {
+                sort_insertionsort(ptrstart + ifirst * elesize, starts[ibucket] - ifirst, elesize, cmp);
+            } else {
+                sort_mergesort(ptrstart + ifirst * elesize, starts[ibucket] - ifirst, elesize, cmp);
+            }
+        }
+    }
+
+    free(starts);
+    free(tmp);
+
+    return path;
+}
@@ -1,11 +1,42 @@
 /*
  * sort.h
- * Version 20170803
+ * Version 20261019
  * Written by Harry Wong (RedAndBlueEraser)
  */
 
+#ifndef SORT_H
+#define SORT_H
+
 #include <stddef.h>
 
+/* Number of element size classes with separate tuning parameters, and the
+ * largest element size in each class except the last (which is unbounded).
+ */
+#define SORT_TUNING_CLASSCOUNT 4
+#define SORT_TUNING_CLASSMAXSIZES { 4, 8, 16 }
+
+/* Maximum number of gaps in a tuned shellsort gap sequence. */
+#define SORT_TUNING_GAPSEQ_MAX 24
+
+/* Tuning parameters for the sorting algorithms. */
+struct sort_tuning {
+    size_t quicksortinssortthres;                    /* Quicksort uses insertion sort at or below this many elements. */
+    double combsortshrinkfactor;                     /* Comb sort gap shrink factor, greater than 1. */
+    size_t shellsortgapseq[SORT_TUNING_GAPSEQ_MAX];  /* Shellsort gaps in descending order, ending with 1. */
+    size_t shellsortgapseqcount;                     /* Number of gaps in shellsort gap sequence. */
+};
+
+/* Get the tuning parameters used to sort elements of the specified size. */
+void sort_gettuning(size_t elesize, struct sort_tuning *tuning);
+
+/* Set the tuning parameters used to sort elements of the specified size.
+ * Returns 0 on success or -1 if the parameters are invalid.
+ */
+int sort_settuning(size_t elesize, const struct sort_tuning *tuning);
+
+/* Restore the tuning parameters of all element sizes to the build defaults. */
+void sort_resettuning(void);
+
 /* Sort the elements in the array with bubble sort. */
 void sort_bubblesort(void *arr, size_t count, size_t elesize,
     int (*cmp)(const void *, const void *));
@@ -30,6 +61,21 @@ void sort_gnomesort(void *arr, size_t count, size_t elesize,
 void sort_quicksort(void *arr, size_t count, size_t elesize,
     int (*cmp)(const void *, const void *));
 
+/* Sort the elements in the array with quicksort, keeping one of each group of
+ * equal elements. Returns the number of distinct elements, which are at the
+ * start of the array.
+ */
+size_t sort_unique(void *arr, size_t count, size_t elesize,
+    int (*cmp)(const void *, const void *));
+
+/* Sort the elements in the array with quicksort, keeping one of each group of
+ * equal elements, and write the number of elements equal to each distinct
+ * element to counts. Returns the number of distinct elements, which are at the
+ * start of the array.
+ */
+size_t sort_group_count(void *arr, size_t count, size_t elesize,
+    int (*cmp)(const void *, const void *), size_t *counts);
+
 /* Sort the elements in the array with slowsort. */
 void sort_slowsort(void *arr, size_t count, size_t elesize,
     int (*cmp)(const void *, const void *));
@@ -57,3 +103,110 @@ void sort_shellsort(void *arr, size_t count, size_t elesize,
 /* Sort the elements in the array with merge sort. */
 void sort_mergesort(void *arr, size_t count, size_t elesize,
     int (*cmp)(const void *, const void *));
+
+/* Sort the ints in the array with merge sort, merging several elements at a
+ * time with SIMD instructions where the processor supports them.
+ */
+void sort_mergesort_int(int *arr, size_t count);
+
+/* Sort the longs in the array with merge sort, merging several elements at a
+ * time with SIMD instructions where the processor supports them.
+ */
+void sort_mergesort_long(long *arr, size_t count);
+
+/* Sort the elements in the key column with merge sort, and move the elements in
+ * each of the payload columns the same way.
+ */
+void sort_columns(void *keys, size_t count, size_t keysize,
+    int (*cmp)(const void *, const void *), void *cols[],
+    const size_t colsizes[], size_t colcount);
+
+/* Paths taken by counting sort. */
+#define SORT_COUNTING_NONE 0       /* Fewer than two elements or all keys are equal. */
+#define SORT_COUNTING_COUNTING 1   /* Elements were counted by key. */
+#define SORT_COUNTING_BUCKET 2     /* Elements were put in buckets of keys and each bucket was sorted. */
+#define SORT_COUNTING_MERGESORT 3  /* Range of keys was too large, and merge sort was used. */
+
+/* Sort the elements in the array with counting sort or bucket sort by their
+ * integer keys. The comparison function must order elements the same as their
+ * keys. Returns the path taken.
+ */
+int sort_counting(void *arr, size_t count, size_t elesize,
+    int (*cmp)(const void *, const void *), long (*key)(const void *));
+
+/* Set the number of threads used by parallel sorts, or 0 for one thread per
+ * online processor, which is the default.
+ */
+void sort_setthreads(size_t nthreads);
+
+/* Get the number of threads used by parallel sorts. */
+size_t sort_getthreads(void);
+
+/* Sort the elements in the array with parallel in-place sample sort. Small
+ * arrays, or a single thread, are sorted with quicksort.
+ */
+void sort_samplesort(void *arr, size_t count, size_t elesize,
+    int (*cmp)(const void *, const void *));
+
+/* States of sort jobs. */
+#define SORT_JOB_QUEUED 0     /* Waiting to start. */
+#define SORT_JOB_RUNNING 1    /* Started, and running or waiting to run its next chunk. */
+#define SORT_JOB_DONE 2       /* Array is sorted. */
+#define SORT_JOB_CANCELLED 3  /* Cancelled, leaving the array a permutation of its elements. */
+
+/* Sort job run in the background by the executor. */
+struct sort_job;
+
+/* Statistics of the executor of sort jobs. Times are in seconds. */
+struct sort_executor_stats {
+    size_t queuedepth,                         /* Number of jobs waiting to run their next chunk. */
+        maxqueuedepth,                         /* Largest number of jobs waiting to run their next chunk. */
+        running;                               /* Number of jobs running a chunk. */
+    unsigned long submitted,                   /* Number of jobs submitted. */
+        completed,                             /* Number of jobs done. */
+        cancelled,                             /* Number of jobs cancelled. */
+        chunks;                                /* Number of chunks run. */
+    double totalwait,                          /* Total time from submitting to starting jobs. */
+        maxwait,                               /* Longest time from submitting to starting a job. */
+        totallatency,                          /* Total time from submitting to finishing done jobs. */
+        maxlatency;                            /* Longest time from submitting to finishing a done job. */
+};
+
+/* Start the executor of sort jobs with the number of worker threads, or 0 for
+ * the number of threads used by parallel sorts. Returns -1 if the executor is
+ * already started.
+ */
+int sort_executor_start(size_t nthreads);
+
+/* Wait for every submitted job to finish, and stop the executor. */
+void sort_executor_shutdown(void);
+
+/* Get the statistics of the executor of sort jobs. */
+void sort_executor_getstats(struct sort_executor_stats *stats);
+
+/* Submit a job that sorts the elements in the array with merge sort in the
+ * background, starting the executor if needed. Jobs run in chunks, so that
+ * jobs of higher priority, then jobs submitted earlier, run first. The
+ * callback, if not NULL, is called with the job's final state when it
+ * finishes, and must not free the job. Returns NULL if the executor is shutting
+ * down.
+ */
+struct sort_job *sort_submit(void *arr, size_t count, size_t elesize,
+    int (*cmp)(const void *, const void *), int priority,
+    void (*callback)(struct sort_job *, int, void *), void *userdata);
+
+/* Get the state of the sort job. */
+int sort_job_poll(struct sort_job *job);
+
+/* Wait for the sort job to finish. Returns its final state. */
+int sort_job_wait(struct sort_job *job);
+
+/* Cancel the sort job. A running job stops after its current chunk. Returns -1
+ * if the job is already finished or cancelled.
+ */
+int sort_job_cancel(struct sort_job *job);
+
+/* Free the finished sort job. */
+void sort_job_free(struct sort_job *job);
+
+#endif
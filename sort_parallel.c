@@ -0,0 +1,1102 @@
+/*
+ * sort_parallel.c
+ * Version 20261019
+ * Written by Harry Wong (RedAndBlueEraser)
+ *
+ * Sorting algorithms that run on several threads with POSIX threads, and an
+ * executor that sorts arrays in the background.
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "sort.h"
+
+#define SORT_SAMPLESORT_BLOCKSIZE 2048
+#define SORT_SAMPLESORT_MAXLOGBUCKETS 7
+#define SORT_SAMPLESORT_OVERSAMPLING 16
+#define SORT_SAMPLESORT_SEQTHRES 65536
+#define SORT_PARALLEL_MAXNODES 64
+#define SORT_JOB_RUNLEN 16
+#define SORT_JOB_CHUNKSIZE 65536
+#define FALSE 0
+#define TRUE !FALSE
+
+/* Barrier that a number of threads wait at until all of them have arrived.
+ * POSIX barriers are optional, so they are built from a lock and a condition.
+ */
+struct sort_parallel_barrier {
+    pthread_mutex_t lock;                      /* Lock of barrier. */
+    pthread_cond_t cond;                       /* Signalled when the last thread arrives. */
+    size_t count,                              /* Number of threads to wait for. */
+        waiting;                               /* Number of threads waiting. */
+    unsigned long generation;                  /* Number of times every thread has arrived. */
+};
+
+/* Shared state of a sample sort distribution of an array into buckets. */
+struct sort_samplesort {
+    char *arr;                                 /* Array to be distributed. */
+    size_t count,                              /* Number of elements in array. */
+        elesize;                               /* Number of bytes of each element. */
+    int (*cmp)(const void *, const void *);    /* Comparison function. */
+    size_t nthreads,                           /* Number of threads. */
+        blockcount,                            /* Number of elements in each block. */
+        stripeblocks;                          /* Number of blocks in each thread's stripe of array. */
+    char *splitters,                           /* Array of distinct splitters in ascending order. */
+        *tree;                                 /* Array of splitters as an implicit binary search tree, from index 1. */
+    size_t nsplitters,                         /* Number of distinct splitters. */
+        logbuckets,                            /* Depth of binary search tree. */
+        nbuckets;                              /* Number of buckets, including equal to buckets. */
+    int equality;                              /* Boolean flag whether elements equal to a splitter have their own bucket. */
+    struct sort_samplesort_thread *threads;    /* Array of per-thread states. */
+    size_t *bucketstarts,                      /* Array of indices of first element in each bucket, and the element count. */
+        *writeblocks,                          /* Array of indices of next block to be written in each bucket. */
+        *readblocks,                           /* Array of indices past last unread block in each bucket. */
+        *savedcounts,                          /* Array of number of elements saved from each bucket. */
+        overflowbucket;                        /* Index of bucket whose block past the end of array is held in overflow, or -1. */
+    char *overflow,                            /* Copy of block that does not fit before the end of array. */
+        *saved;                                /* Array of elements of each bucket written past the bucket's end. */
+    pthread_mutex_t *bucketlocks;              /* Array of locks of the read and write blocks of each bucket. */
+    struct sort_parallel_barrier barrier;      /* Barrier between steps of distribution. */
+};
+
+/* Per-thread state of a sample sort distribution. */
+struct sort_samplesort_thread {
+    struct sort_samplesort *ss;                /* Shared state. */
+    size_t id;                                 /* Index of thread. */
+    char *buffers;                             /* Array of one block buffer for each bucket. */
+    size_t *buffercounts,                      /* Array of number of elements in each buffer. */
+        *bucketcounts,                         /* Array of number of elements of stripe in each bucket. */
+        writeend;                              /* Index past last full block written back to stripe. */
+    char *swap;                                /* Two blocks to move blocks between buckets with. */
+};
+
+/* Shared state of sorting the buckets left after a distribution. */
+struct sort_samplesort_buckets {
+    char *arr;                                 /* Array of buckets. */
+    size_t elesize;                            /* Number of bytes of each element. */
+    int (*cmp)(const void *, const void *);    /* Comparison function. */
+    size_t *bucketstarts,                      /* Array of indices of first element in each bucket. */
+        nbuckets,                              /* Number of buckets. */
+        step,                                  /* Distance between indices of buckets to be sorted. */
+        maxcount,                              /* Number of elements of largest bucket to be sorted. */
+        next;                                  /* Index of next bucket to be sorted. */
+    pthread_mutex_t lock;                      /* Lock of next bucket. */
+};
+
+/* Per-thread argument of a parallel step. */
+struct sort_parallel_thread {
+    void *(*func)(void *);                     /* Function run by thread. */
+    void *arg;                                 /* Argument of function. */
+    size_t id;                                 /* Index of thread. */
+};
+
+static size_t sort_parallel_nthreads = 0;      /* Number of threads set, or 0 for one per online processor. */
+#ifdef __linux__
+static pthread_once_t sort_parallel_numaonce = PTHREAD_ONCE_INIT;
+static cpu_set_t sort_parallel_nodecpus[SORT_PARALLEL_MAXNODES];
+static int sort_parallel_nnodes = 0;           /* Number of NUMA nodes with processors. */
+#endif
+
+static void *sort_parallel_malloc(size_t size) {
+    void *ptr = malloc(size ? size : 1);
+    if (!ptr) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    return ptr;
+}
+
+static void sort_parallel_barrier_init(struct sort_parallel_barrier *barrier, size_t count) {
+    pthread_mutex_init(&barrier->lock, NULL);
+    pthread_cond_init(&barrier->cond, NULL);
+    barrier->count = count;
+    barrier->waiting = 0;
+    barrier->generation = 0;
+}
+
+static void sort_parallel_barrier_destroy(struct sort_parallel_barrier *barrier) {
+    pthread_mutex_destroy(&barrier->lock);
+    pthread_cond_destroy(&barrier->cond);
+}
+
+/* Wait until every thread has arrived at the barrier. */
+static void sort_parallel_barrier_wait(struct sort_parallel_barrier *barrier) {
+    unsigned long generation;
+
+    pthread_mutex_lock(&barrier->lock);
+    generation = barrier->generation;
+    if (++barrier->waiting == barrier->count) {
+        barrier->waiting = 0;
+        barrier->generation++;
+        pthread_cond_broadcast(&barrier->cond);
+    } else {
+        while (generation == barrier->generation) {
+            pthread_cond_wait(&barrier->cond, &barrier->lock);
+        }
+    }
+    pthread_mutex_unlock(&barrier->lock);
+}
+
+void sort_setthreads(size_t nthreads) {
+    sort_parallel_nthreads = nthreads;
+}
+
+size_t sort_getthreads(void) {
+    long nprocs = 1;
+
+    if (sort_parallel_nthreads) {
+        return sort_parallel_nthreads;
+    }
+#ifdef _SC_NPROCESSORS_ONLN
+    nprocs = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return nprocs > 0 ? (size_t)nprocs : 1;
+}
+
+#ifdef __linux__
+
+/* Read the processors of each NUMA node from sysfs. Machines with one node, or
+ * without sysfs, are treated as having no nodes, so threads are not pinned.
+ */
+static void sort_parallel_numainit(void) {
+    char path[64];
+    FILE *file;
+    unsigned long first, last;
+    int node, c;
+
+    for (node = 0; node < SORT_PARALLEL_MAXNODES; node++) {
+        sprintf(path, "/sys/devices/system/node/node%d/cpulist", node);
+        file = fopen(path, "r");
+        if (!file) {
+            break;
+        }
+
+        /* Parse a list of processor ranges such as "0-3,8-11". */
+        CPU_ZERO(&sort_parallel_nodecpus[node]);
+        while (fscanf(file, "%lu", &first) == 1) {
+            last = first;
+            c = fgetc(file);
+            if (c == '-') {
+                if (fscanf(file, "%lu", &last) != 1) {
+                    break;
+                }
+                c = fgetc(file);
+            }
+            for (; first <= last && first < CPU_SETSIZE; first++) {
+                CPU_SET(first, &sort_parallel_nodecpus[node]);
+            }
+            if (c != ',') {
+                break;
+            }
+        }
+        fclose(file);
+
+        if (CPU_COUNT(&sort_parallel_nodecpus[node]) == 0) {
+            break;
+        }
+    }
+
+    sort_parallel_nnodes = node > 1 ? node : 0;
+}
+
+#endif
+
+/* Run a thread's function after pinning the thread to the processors of a NUMA
+ * node on Linux, spreading threads over nodes in turn, so that the memory it
+ * allocates and touches first is local to it.
+ */
+static void *sort_parallel_start(void *arg) {
+    struct sort_parallel_thread *thread = (struct sort_parallel_thread *)arg;
+
+#ifdef __linux__
+    if (sort_parallel_nnodes > 1) {
+        pthread_setaffinity_np(pthread_self(), sizeof (cpu_set_t), &sort_parallel_nodecpus[thread->id % sort_parallel_nnodes]);
+    }
+#endif
+    return thread->func(thread->arg);
+}
+
+/* Run the function on the specified number of threads, each with its own
+ * argument, and wait for all of them to finish.
+ */
+static void sort_parallel_run(size_t nthreads, void *(*func)(void *), void *args, size_t argsize) {
+    pthread_t *pthreads = (pthread_t *)sort_parallel_malloc(nthreads * sizeof (pthread_t));
+    struct sort_parallel_thread *threads = (struct sort_parallel_thread *)sort_parallel_malloc(nthreads * sizeof (struct sort_parallel_thread));
+    size_t i;
+
+#ifdef __linux__
+    pthread_once(&sort_parallel_numaonce, sort_parallel_numainit);
+#endif
+
+    for (i = 0; i < nthreads; i++) {
+        threads[i].func = func;
+        threads[i].arg = (char *)args + i * argsize;
+        threads[i].id = i;
+        if (pthread_create(&pthreads[i], NULL, sort_parallel_start, &threads[i])) {
+            fprintf(stderr, "Cannot create thread\n");
+            exit(1);
+        }
+    }
+    for (i = 0; i < nthreads; i++) {
+        pthread_join(pthreads[i], NULL);
+    }
+
+    free(pthreads);
+    free(threads);
+}
+
+/* Build the implicit binary search tree from the splitters in ascending order,
+ * so that the children of the node at index i are at indices 2i and 2i + 1.
+ */
+static void sort_samplesort_buildtree(struct sort_samplesort *ss, const char *sorted, size_t node, size_t lo, size_t hi) {
+    size_t mid = lo + (hi - lo) / 2;
+
+    memcpy(ss->tree + node * ss->elesize, sorted + mid * ss->elesize, ss->elesize);
+    if (lo < mid) {
+        sort_samplesort_buildtree(ss, sorted, 2 * node, lo, mid - 1);
+        sort_samplesort_buildtree(ss, sorted, 2 * node + 1, mid + 1, hi);
+    }
+}
+
+/* Get the bucket of the element. The binary search tree is walked down without
+ * branching on the comparisons, counting the splitters smaller than the
+ * element. Elements equal to a splitter get the bucket after it if equal to
+ * buckets are used.
+ */
+static size_t sort_samplesort_classify(const struct sort_samplesort *ss, const char *ptr) {
+    size_t i = 1, level;
+
+    for (level = 0; level < ss->logbuckets; level++) {
+        i = 2 * i + (ss->cmp(ss->tree + i * ss->elesize, ptr) < 0);
+    }
+    i -= (size_t)1 << ss->logbuckets;
+
+    if (ss->equality) {
+        i = 2 * i + (i < ss->nsplitters && ss->cmp(ptr, ss->splitters + i * ss->elesize) == 0);
+    }
+    return i;
+}
+
+/* Choose the splitters from a random sample of the array, which is moved to the
+ * start of the array.
+ */
+static void sort_samplesort_sample(struct sort_samplesort *ss, size_t maxlogbuckets) {
+    size_t nsamples = SORT_SAMPLESORT_OVERSAMPLING << maxlogbuckets,
+        nbuckets = (size_t)1 << maxlogbuckets,
+        elesize = ss->elesize,
+        i, j, nsorted;
+    unsigned long random = 1;
+    char *sorted, *ptr;
+
+    /* Move random elements to the start of the array and sort them. */
+    if (nsamples > ss->count) {
+        nsamples = ss->count;
+    }
+    for (i = 0; i < nsamples; i++) {
+        random = random * 6364136223846793005UL + 1442695040888963407UL;
+        j = i + (size_t)((random >> 16) % (ss->count - i));
+        if (i != j) {
+            memcpy(ss->overflow, ss->arr + i * elesize, elesize);
+            memcpy(ss->arr + i * elesize, ss->arr + j * elesize, elesize);
+            memcpy(ss->arr + j * elesize, ss->overflow, elesize);
+        }
+    }
+    sort_quicksort(ss->arr, nsamples, elesize, ss->cmp);
+
+    /* Take equally spaced samples as splitters, leaving out duplicates. If
+     * there are duplicates, the sample has many equal elements, so elements
+     * equal to a splitter get their own bucket.
+     */
+    ss->splitters = (char *)sort_parallel_malloc(nbuckets * elesize);
+    ss->nsplitters = 0;
+    ss->equality = FALSE;
+    for (i = 1; i < nbuckets; i++) {
+        ptr = ss->arr + (i * nsamples / nbuckets) * elesize;
+        if (ss->nsplitters > 0 && ss->cmp(ss->splitters + (ss->nsplitters - 1) * elesize, ptr) == 0) {
+            ss->equality = TRUE;
+        } else {
+            memcpy(ss->splitters + ss->nsplitters++ * elesize, ptr, elesize);
+        }
+    }
+
+    /* Use the shallowest tree that fits the splitters, and fill it up with
+     * copies of the largest splitter, which leaves buckets empty.
+     */
+    ss->logbuckets = 1;
+    while (((size_t)1 << ss->logbuckets) - 1 < ss->nsplitters) {
+        ss->logbuckets++;
+    }
+    nsorted = ((size_t)1 << ss->logbuckets) - 1;
+    sorted = (char *)sort_parallel_malloc(nsorted * elesize);
+    memcpy(sorted, ss->splitters, ss->nsplitters * elesize);
+    for (i = ss->nsplitters; i < nsorted; i++) {
+        memcpy(sorted + i * elesize, ss->splitters + (ss->nsplitters - 1) * elesize, elesize);
+    }
+    ss->tree = (char *)sort_parallel_malloc((nsorted + 1) * elesize);
+    sort_samplesort_buildtree(ss, sorted, 1, 0, nsorted - 1);
+    free(sorted);
+
+    ss->nbuckets = (size_t)1 << ss->logbuckets;
+    if (ss->equality) {
+        ss->nbuckets *= 2;
+    }
+}
+
+/* Test whether the block at the index was filled during local classification.
+ * Each thread writes full blocks from the start of its stripe.
+ */
+static int sort_samplesort_isfull(const struct sort_samplesort *ss, size_t iblock) {
+    return iblock * ss->blockcount < ss->threads[iblock / ss->stripeblocks].writeend;
+}
+
+/* Copy elements of a bucket into the next positions of the bucket's holes at
+ * its start and end.
+ */
+static void sort_samplesort_fill(const struct sort_samplesort *ss, size_t *ptrihole, size_t headend, size_t tailstart, const char *src, size_t count) {
+    size_t n;
+
+    while (count > 0) {
+        if (*ptrihole == headend) {
+            *ptrihole = tailstart;
+        }
+        n = *ptrihole < headend ? headend - *ptrihole : count;
+        if (n > count) {
+            n = count;
+        }
+        memcpy(ss->arr + *ptrihole * ss->elesize, src, n * ss->elesize);
+        *ptrihole += n;
+        src += n * ss->elesize;
+        count -= n;
+    }
+}
+
+static void *sort_samplesort_thread(void *arg) {
+    struct sort_samplesort_thread *thread = (struct sort_samplesort_thread *)arg;
+    struct sort_samplesort *ss = thread->ss;
+    size_t elesize = ss->elesize,
+        blockcount = ss->blockcount,
+        blocksize = blockcount * elesize,
+        nblocks = (ss->count + blockcount - 1) / blockcount,
+        begin = thread->id * ss->stripeblocks * blockcount,
+        end = begin + ss->stripeblocks * blockcount,
+        ibucket, k, lo, hi, iblock, headend, tailstart, validend, ihole, t;
+    char *ptr, *ptrend, *buffer, *src, *dst, *tmp;
+
+    if (begin > ss->count) {
+        begin = ss->count;
+    }
+    if (end > ss->count) {
+        end = ss->count;
+    }
+
+    /* Allocate this thread's buffers here, so that they are local to it. */
+    thread->buffers = (char *)sort_parallel_malloc(ss->nbuckets * blocksize);
+    thread->buffercounts = (size_t *)calloc(ss->nbuckets, sizeof (size_t));
+    thread->bucketcounts = (size_t *)calloc(ss->nbuckets, sizeof (size_t));
+    thread->swap = (char *)sort_parallel_malloc(2 * blocksize);
+    if (!thread->buffercounts || !thread->bucketcounts) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+
+    /* Classify each element of the stripe into its bucket's buffer. When a
+     * buffer is full, write it back as a block to the start of the stripe,
+     * which has already been read.
+     */
+    thread->writeend = begin;
+    for (ptr = ss->arr + begin * elesize, ptrend = ss->arr + end * elesize; ptr < ptrend; ptr += elesize) {
+        ibucket = sort_samplesort_classify(ss, ptr);
+        buffer = thread->buffers + ibucket * blocksize;
+        if (thread->buffercounts[ibucket] == blockcount) {
+            memcpy(ss->arr + thread->writeend * elesize, buffer, blocksize);
+            thread->writeend += blockcount;
+            thread->buffercounts[ibucket] = 0;
+        }
+        memcpy(buffer + thread->buffercounts[ibucket]++ * elesize, ptr, elesize);
+        thread->bucketcounts[ibucket]++;
+    }
+
+    sort_parallel_barrier_wait(&ss->barrier);
+
+    /* Find the start of each bucket from the counts of every thread. Each
+     * bucket's blocks go from its first block boundary onwards.
+     */
+    if (thread->id == 0) {
+        ss->bucketstarts[0] = 0;
+        for (ibucket = 0; ibucket < ss->nbuckets; ibucket++) {
+            ss->bucketstarts[ibucket + 1] = ss->bucketstarts[ibucket];
+            for (t = 0; t < ss->nthreads; t++) {
+                ss->bucketstarts[ibucket + 1] += ss->threads[t].bucketcounts[ibucket];
+            }
+            ss->writeblocks[ibucket] = (ss->bucketstarts[ibucket] + blockcount - 1) / blockcount;
+        }
+        ss->writeblocks[ss->nbuckets] = nblocks;
+    }
+
+    sort_parallel_barrier_wait(&ss->barrier);
+
+    /* Move the full blocks in each bucket's blocks to the start of them. */
+    for (ibucket = thread->id; ibucket < ss->nbuckets; ibucket += ss->nthreads) {
+        lo = ss->writeblocks[ibucket];
+        hi = ss->writeblocks[ibucket + 1];
+        for (;;) {
+            while (lo < hi && sort_samplesort_isfull(ss, lo)) {
+                lo++;
+            }
+            while (lo < hi && !sort_samplesort_isfull(ss, hi - 1)) {
+                hi--;
+            }
+            if (lo >= hi) {
+                break;
+            }
+            memcpy(ss->arr + lo * blocksize, ss->arr + (hi - 1) * blocksize, blocksize);
+            lo++;
+            hi--;
+        }
+        ss->readblocks[ibucket] = lo;
+    }
+
+    sort_parallel_barrier_wait(&ss->barrier);
+
+    /* Move each full block to its bucket. Take a block from the end of a
+     * bucket's unread blocks, and write it to the next block of its bucket. If
+     * that block is unread, take it out first and move it the same way,
+     * otherwise stop. Threads start at different buckets and take turns with
+     * locks.
+     */
+    src = thread->swap;
+    dst = thread->swap + blocksize;
+    for (k = 0; k < ss->nbuckets; k++) {
+        ibucket = (thread->id * ss->nbuckets / ss->nthreads + k) % ss->nbuckets;
+        for (;;) {
+            pthread_mutex_lock(&ss->bucketlocks[ibucket]);
+            if (ss->readblocks[ibucket] <= ss->writeblocks[ibucket]) {
+                pthread_mutex_unlock(&ss->bucketlocks[ibucket]);
+                break;
+            }
+            iblock = --ss->readblocks[ibucket];
+            memcpy(src, ss->arr + iblock * blocksize, blocksize);
+            pthread_mutex_unlock(&ss->bucketlocks[ibucket]);
+
+            for (;;) {
+                t = sort_samplesort_classify(ss, src);
+                pthread_mutex_lock(&ss->bucketlocks[t]);
+                iblock = ss->writeblocks[t]++;
+                if (iblock < ss->readblocks[t]) {
+                    memcpy(dst, ss->arr + iblock * blocksize, blocksize);
+                    memcpy(ss->arr + iblock * blocksize, src, blocksize);
+                    pthread_mutex_unlock(&ss->bucketlocks[t]);
+                    tmp = src;
+                    src = dst;
+                    dst = tmp;
+                    continue;
+                }
+
+                /* A block that would run past the end of the array is held
+                 * aside until cleanup.
+                 */
+                if ((iblock + 1) * blockcount > ss->count) {
+                    memcpy(ss->overflow, src, blocksize);
+                    ss->overflowbucket = t;
+                } else {
+                    memcpy(ss->arr + iblock * blocksize, src, blocksize);
+                }
+                pthread_mutex_unlock(&ss->bucketlocks[t]);
+                break;
+            }
+        }
+    }
+
+    sort_parallel_barrier_wait(&ss->barrier);
+
+    /* Save the elements of each bucket's last block that run past the bucket's
+     * end, before the next bucket overwrites them.
+     */
+    for (ibucket = thread->id; ibucket < ss->nbuckets; ibucket += ss->nthreads) {
+        lo = (ss->bucketstarts[ibucket] + blockcount - 1) / blockcount * blockcount;
+        validend = (ss->writeblocks[ibucket] - (ss->overflowbucket == ibucket)) * blockcount;
+        if (validend < lo) {
+            validend = lo;
+        }
+        hi = ss->bucketstarts[ibucket + 1] > lo ? ss->bucketstarts[ibucket + 1] : lo;
+        ss->savedcounts[ibucket] = validend > hi ? validend - hi : 0;
+        memcpy(ss->saved + ibucket * blocksize, ss->arr + hi * elesize, ss->savedcounts[ibucket] * elesize);
+    }
+
+    sort_parallel_barrier_wait(&ss->barrier);
+
+    /* Fill the holes at the start and end of each bucket with its saved
+     * elements, its block held aside and the elements left in every thread's
+     * buffer.
+     */
+    for (ibucket = thread->id; ibucket < ss->nbuckets; ibucket += ss->nthreads) {
+        lo = (ss->bucketstarts[ibucket] + blockcount - 1) / blockcount * blockcount;
+        validend = (ss->writeblocks[ibucket] - (ss->overflowbucket == ibucket)) * blockcount;
+        if (validend < lo) {
+            validend = lo;
+        }
+        headend = lo < ss->bucketstarts[ibucket + 1] ? lo : ss->bucketstarts[ibucket + 1];
+        tailstart = validend;
+        ihole = ss->bucketstarts[ibucket];
+
+        sort_samplesort_fill(ss, &ihole, headend, tailstart, ss->saved + ibucket * blocksize, ss->savedcounts[ibucket]);
+        if (ss->overflowbucket == ibucket) {
+            sort_samplesort_fill(ss, &ihole, headend, tailstart, ss->overflow, blockcount);
+        }
+        for (t = 0; t < ss->nthreads; t++) {
+            sort_samplesort_fill(ss, &ihole, headend, tailstart, ss->threads[t].buffers + ibucket * blocksize, ss->threads[t].buffercounts[ibucket]);
+        }
+    }
+
+    return NULL;
+}
+
+static void *sort_samplesort_bucketsthread(void *arg) {
+    struct sort_samplesort_buckets *sb = *(struct sort_samplesort_buckets **)arg;
+    size_t ibucket;
+
+    /* Take the next bucket and sort it until none are left. */
+    for (;;) {
+        pthread_mutex_lock(&sb->lock);
+        ibucket = sb->next;
+        sb->next += sb->step;
+        pthread_mutex_unlock(&sb->lock);
+        if (ibucket >= sb->nbuckets) {
+            break;
+        }
+        if (sb->bucketstarts[ibucket + 1] - sb->bucketstarts[ibucket] > sb->maxcount) {
+            continue;
+        }
+        sort_quicksort(sb->arr + sb->bucketstarts[ibucket] * sb->elesize,
+            sb->bucketstarts[ibucket + 1] - sb->bucketstarts[ibucket], sb->elesize, sb->cmp);
+    }
+
+    return NULL;
+}
+
+static void sort_samplesort_parallel(void *arr, size_t count, size_t elesize, int (*cmp)(const void *, const void *), size_t nthreads) {
+    struct sort_samplesort ss;
+    struct sort_samplesort_buckets sb, **sbs;
+    size_t maxlogbuckets, ibucket, step, bucketcount, t;
+
+    /* Sort with quicksort if there are few elements or one thread. */
+    if (count < SORT_SAMPLESORT_SEQTHRES || nthreads <= 1) {
+        sort_quicksort(arr, count, elesize, cmp);
+        return;
+    }
+
+    ss.arr = (char *)arr;
+    ss.count = count;
+    ss.elesize = elesize;
+    ss.cmp = cmp;
+    ss.nthreads = nthreads;
+    ss.blockcount = elesize < SORT_SAMPLESORT_BLOCKSIZE ? SORT_SAMPLESORT_BLOCKSIZE / elesize : 1;
+    ss.stripeblocks = ((count + ss.blockcount - 1) / ss.blockcount + nthreads - 1) / nthreads;
+    ss.overflow = (char *)sort_parallel_malloc(ss.blockcount * elesize);
+    ss.overflowbucket = (size_t)-1;
+
+    /* Use more buckets for more elements, with at least a few blocks each. */
+    maxlogbuckets = 1;
+    while (maxlogbuckets < SORT_SAMPLESORT_MAXLOGBUCKETS && ((size_t)4 << maxlogbuckets) * ss.blockcount <= count) {
+        maxlogbuckets++;
+    }
+    sort_samplesort_sample(&ss, maxlogbuckets);
+
+    ss.threads = (struct sort_samplesort_thread *)sort_parallel_malloc(nthreads * sizeof (struct sort_samplesort_thread));
+    ss.bucketstarts = (size_t *)sort_parallel_malloc((ss.nbuckets + 1) * sizeof (size_t));
+    ss.writeblocks = (size_t *)sort_parallel_malloc((ss.nbuckets + 1) * sizeof (size_t));
+    ss.readblocks = (size_t *)sort_parallel_malloc(ss.nbuckets * sizeof (size_t));
+    ss.savedcounts = (size_t *)sort_parallel_malloc(ss.nbuckets * sizeof (size_t));
+    ss.saved = (char *)sort_parallel_malloc(ss.nbuckets * ss.blockcount * elesize);
+    ss.bucketlocks = (pthread_mutex_t *)sort_parallel_malloc(ss.nbuckets * sizeof (pthread_mutex_t));
+    for (ibucket = 0; ibucket < ss.nbuckets; ibucket++) {
+        pthread_mutex_init(&ss.bucketlocks[ibucket], NULL);
+    }
+    sort_parallel_barrier_init(&ss.barrier, nthreads);
+    for (t = 0; t < nthreads; t++) {
+        ss.threads[t].ss = &ss;
+        ss.threads[t].id = t;
+    }
+
+    /* Distribute the elements into buckets with every thread. */
+    sort_parallel_run(nthreads, sort_samplesort_thread, ss.threads, sizeof (struct sort_samplesort_thread));
+
+    sort_parallel_barrier_destroy(&ss.barrier);
+    for (ibucket = 0; ibucket < ss.nbuckets; ibucket++) {
+        pthread_mutex_destroy(&ss.bucketlocks[ibucket]);
+    }
+    for (t = 0; t < nthreads; t++) {
+        free(ss.threads[t].buffers);
+        free(ss.threads[t].buffercounts);
+        free(ss.threads[t].bucketcounts);
+        free(ss.threads[t].swap);
+    }
+    free(ss.threads);
+    free(ss.writeblocks);
+    free(ss.readblocks);
+    free(ss.savedcounts);
+    free(ss.saved);
+    free(ss.bucketlocks);
+    free(ss.overflow);
+    free(ss.splitters);
+    free(ss.tree);
+
+    /* Elements in equal buckets are already in place. Sort each bucket
+     * larger than a thread's share with every thread, one after another, and
+     * then share out the other buckets between the threads. A bucket of every
+     * element made no progress, so it is sorted with quicksort instead.
+     */
+    step = ss.equality ? 2 : 1;
+    for (ibucket = 0; ibucket < ss.nbuckets; ibucket += step) {
+        bucketcount = ss.bucketstarts[ibucket + 1] - ss.bucketstarts[ibucket];
+        if (bucketcount == count) {
+            sort_quicksort(arr, count, elesize, cmp);
+        } else if (bucketcount > count / nthreads) {
+            sort_samplesort_parallel((char *)arr + ss.bucketstarts[ibucket] * elesize, bucketcount, elesize, cmp, nthreads);
+        }
+    }
+
+    sb.arr = (char *)arr;
+    sb.elesize = elesize;
+    sb.cmp = cmp;
+    sb.bucketstarts = ss.bucketstarts;
+    sb.nbuckets = ss.nbuckets;
+    sb.step = step;
+    sb.maxcount = count / nthreads;
+    sb.next = 0;
+    pthread_mutex_init(&sb.lock, NULL);
+    sbs = (struct sort_samplesort_buckets **)sort_parallel_malloc(nthreads * sizeof (struct sort_samplesort_buckets *));
+    for (t = 0; t < nthreads; t++) {
+        sbs[t] = &sb;
+    }
+    sort_parallel_run(nthreads, sort_samplesort_bucketsthread, sbs, sizeof (struct sort_samplesort_buckets *));
+    pthread_mutex_destroy(&sb.lock);
+    free(sbs);
+    free(ss.bucketstarts);
+}
+
+void sort_samplesort(void *arr, size_t count, size_t elesize, int (*cmp)(const void *, const void *)) {
+    sort_samplesort_parallel(arr, count, elesize, cmp, sort_getthreads());
+}
+
+/* A sort job run by the executor. */
+struct sort_job {
+    char *arr;                                 /* Array to be sorted. */
+    size_t count,                              /* Number of elements in array. */
+        elesize;                               /* Number of bytes of each element. */
+    int (*cmp)(const void *, const void *);    /* Comparison function. */
+    int priority;                              /* Priority, where jobs of higher priority run first. */
+    void (*callback)(struct sort_job *, int, void *);  /* Function called when the job finishes, or NULL. */
+    void *userdata;                            /* Argument of callback. */
+    unsigned long seq;                         /* Order in which the job was queued, among jobs of equal priority. */
+    int state,                                 /* State of job. */
+        isqueued,                              /* Boolean flag whether the job is in the queue. */
+        isfinished,                            /* Boolean flag whether the job is finishing or finished. */
+        iscancelled;                           /* Boolean flag whether the job was cancelled while running. */
+    char *buffer,                              /* Copy of array to merge to and from. */
+        *src,                                  /* Array being merged from. */
+        *dst;                                  /* Array being merged to. */
+    size_t width,                              /* Number of elements of runs being merged, or 0 while sorting runs. */
+        start,                                 /* Index of first element of runs being merged. */
+        left,                                  /* Index of next element of left run. */
+        right,                                 /* Index of next element of right run. */
+        out;                                   /* Index of next element to be merged to. */
+    struct timespec submittime;                /* Time the job was submitted. */
+};
+
+/* Executor of sort jobs, with a queue of jobs ordered by priority. */
+static struct {
+    pthread_mutex_t lock;                      /* Lock of executor and every job's state. */
+    pthread_cond_t queuecond,                  /* Signalled when a job is queued or the executor shuts down. */
+        donecond;                              /* Signalled when a job finishes. */
+    pthread_t *threads;                        /* Array of worker threads. */
+    size_t nthreads;                           /* Number of worker threads, or 0 if not started. */
+    struct sort_job **queue;                   /* Binary heap of queued jobs. */
+    size_t queuecount,                         /* Number of queued jobs. */
+        queuesize;                             /* Capacity of queue. */
+    unsigned long seq;                         /* Order of next job queued. */
+    int isshuttingdown;                        /* Boolean flag whether the executor is shutting down. */
+    struct sort_executor_stats stats;          /* Statistics of executor. */
+} sort_executor = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER };
+
+/* Get the number of seconds elapsed since the time. */
+static double sort_job_elapsed(const struct timespec *since) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)(now.tv_sec - since->tv_sec) + (double)(now.tv_nsec - since->tv_nsec) / 1e9;
+}
+
+/* Test whether the job should run before the other job. */
+static int sort_job_before(const struct sort_job *job, const struct sort_job *other) {
+    return job->priority != other->priority ? job->priority > other->priority : job->seq < other->seq;
+}
+
+/* Move the job at the index up or down the queue until it is in order. */
+static void sort_executor_siftqueue(size_t i) {
+    struct sort_job **queue = sort_executor.queue, *job = queue[i];
+    size_t child;
+
+    while (i > 0 && sort_job_before(job, queue[(i - 1) / 2])) {
+        queue[i] = queue[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    while ((child = 2 * i + 1) < sort_executor.queuecount) {
+        if (child + 1 < sort_executor.queuecount && sort_job_before(queue[child + 1], queue[child])) {
+            child++;
+        }
+        if (!sort_job_before(queue[child], job)) {
+            break;
+        }
+        queue[i] = queue[child];
+        i = child;
+    }
+    queue[i] = job;
+}
+
+/* Add the job to the queue, behind queued jobs of equal priority. The lock must
+ * be held.
+ */
+static void sort_executor_push(struct sort_job *job) {
+    if (sort_executor.queuecount == sort_executor.queuesize) {
+        sort_executor.queuesize = sort_executor.queuesize ? 2 * sort_executor.queuesize : 16;
+        sort_executor.queue = (struct sort_job **)realloc(sort_executor.queue, sort_executor.queuesize * sizeof (struct sort_job *));
+        if (!sort_executor.queue) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+
+    job->seq = sort_executor.seq++;
+    job->isqueued = TRUE;
+    sort_executor.queue[sort_executor.queuecount++] = job;
+    sort_executor_siftqueue(sort_executor.queuecount - 1);
+
+    sort_executor.stats.queuedepth = sort_executor.queuecount;
+    if (sort_executor.stats.maxqueuedepth < sort_executor.queuecount) {
+        sort_executor.stats.maxqueuedepth = sort_executor.queuecount;
+    }
+    pthread_cond_signal(&sort_executor.queuecond);
+}
+
+/* Remove the job from the queue. The lock must be held. */
+static void sort_executor_remove(struct sort_job *job) {
+    size_t i;
+
+    for (i = 0; sort_executor.queue[i] != job; i++);
+    sort_executor.queue[i] = sort_executor.queue[--sort_executor.queuecount];
+    if (i < sort_executor.queuecount) {
+        sort_executor_siftqueue(i);
+    }
+
+    job->isqueued = FALSE;
+    sort_executor.stats.queuedepth = sort_executor.queuecount;
+}
+
+/* Run the job's merge sort for about the number of element moves, continuing
+ * from where it stopped. Returns TRUE once the array is sorted.
+ */
+static int sort_job_step(struct sort_job *job, size_t budget) {
+    size_t elesize = job->elesize, count = job->count, mid, end, n;
+    char *tmp;
+
+    while (budget > 0) {
+        /* Sort short runs with insertion sort. */
+        if (job->width == 0) {
+            if (job->start < count) {
+                n = count - job->start < SORT_JOB_RUNLEN ? count - job->start : SORT_JOB_RUNLEN;
+                sort_insertionsort(job->arr + job->start * elesize, n, elesize, job->cmp);
+                job->start += n;
+                budget -= n < budget ? n : budget;
+                continue;
+            }
+            job->width = SORT_JOB_RUNLEN;
+            job->start = job->left = job->out = 0;
+            job->right = job->width < count ? job->width : count;
+        }
+
+        /* Finish once a single run is left, in the array. */
+        if (job->width >= count) {
+            if (job->src != job->arr) {
+                memcpy(job->arr, job->src, count * elesize);
+                job->src = job->arr;
+            }
+            return TRUE;
+        }
+
+        /* Merge the next pair of runs, or start merging the other way with
+         * runs twice as long.
+         */
+        if (job->start >= count) {
+            tmp = job->src;
+            job->src = job->dst;
+            job->dst = tmp;
+            job->width *= 2;
+            job->start = job->left = job->out = 0;
+            job->right = job->width < count ? job->width : count;
+            continue;
+        }
+        mid = job->start + job->width < count ? job->start + job->width : count;
+        end = job->start + 2 * job->width < count ? job->start + 2 * job->width : count;
+        for (; budget > 0 && job->out < end; budget--, job->out++) {
+            if (job->left < mid && (job->right >= end || job->cmp(job->src + job->left * elesize, job->src + job->right * elesize) <= 0)) {
+                memcpy(job->dst + job->out * elesize, job->src + job->left++ * elesize, elesize);
+            } else {
+                memcpy(job->dst + job->out * elesize, job->src + job->right++ * elesize, elesize);
+            }
+        }
+        if (job->out == end) {
+            job->start = job->left = end;
+            job->right = end + job->width < count ? end + job->width : count;
+        }
+    }
+
+    return FALSE;
+}
+
+/* Finish the job, calling its callback and waking threads waiting on it. A
+ * cancelled job's array is restored to a permutation of its elements. The
+ * lock must be held, and is released while the callback runs.
+ */
+static void sort_job_finish(struct sort_job *job, int state) {
+    double latency = sort_job_elapsed(&job->submittime);
+
+    job->isfinished = TRUE;
+    if (state == SORT_JOB_CANCELLED) {
+        if (job->src && job->src != job->arr) {
+            memcpy(job->arr, job->src, job->count * job->elesize);
+        }
+        sort_executor.stats.cancelled++;
+    } else {
+        sort_executor.stats.completed++;
+        sort_executor.stats.totallatency += latency;
+        if (sort_executor.stats.maxlatency < latency) {
+            sort_executor.stats.maxlatency = latency;
+        }
+    }
+    free(job->buffer);
+    job->buffer = job->src = job->dst = NULL;
+
+    if (job->callback) {
+        pthread_mutex_unlock(&sort_executor.lock);
+        job->callback(job, state, job->userdata);
+        pthread_mutex_lock(&sort_executor.lock);
+    }
+    job->state = state;
+    pthread_cond_broadcast(&sort_executor.donecond);
+}
+
+static void *sort_executor_thread(void *arg) {
+    struct sort_job *job;
+    double wait;
+    int issorted;
+
+    pthread_mutex_lock(&sort_executor.lock);
+    for (;;) {
+        while (sort_executor.queuecount == 0 && !sort_executor.isshuttingdown) {
+            pthread_cond_wait(&sort_executor.queuecond, &sort_executor.lock);
+        }
+        if (sort_executor.queuecount == 0) {
+            break;
+        }
+
+        /* Take the first job from the queue. */
+        job = sort_executor.queue[0];
+        sort_executor_remove(job);
+        if (job->state == SORT_JOB_QUEUED) {
+            job->state = SORT_JOB_RUNNING;
+            wait = sort_job_elapsed(&job->submittime);
+            sort_executor.stats.totalwait += wait;
+            if (sort_executor.stats.maxwait < wait) {
+                sort_executor.stats.maxwait = wait;
+            }
+        }
+        sort_executor.stats.running++;
+        pthread_mutex_unlock(&sort_executor.lock);
+
+        /* Run one chunk of the job. */
+        if (!job->buffer) {
+            job->buffer = (char *)sort_parallel_malloc(job->count * job->elesize);
+            job->src = job->arr;
+            job->dst = job->buffer;
+        }
+        issorted = sort_job_step(job, SORT_JOB_CHUNKSIZE);
+
+        /* Finish the job, or queue it again behind jobs of equal priority. */
+        pthread_mutex_lock(&sort_executor.lock);
+        sort_executor.stats.running--;
+        sort_executor.stats.chunks++;
+        if (job->iscancelled) {
+            sort_job_finish(job, SORT_JOB_CANCELLED);
+        } else if (issorted) {
+            sort_job_finish(job, SORT_JOB_DONE);
+        } else {
+            sort_executor_push(job);
+        }
+    }
+    pthread_mutex_unlock(&sort_executor.lock);
+
+    return NULL;
+}
+
+/* Create the worker threads of the executor. The lock must be held, and the
+ * executor must not be started.
+ */
+static void sort_executor_createthreads(size_t nthreads) {
+    size_t i;
+
+    sort_executor.nthreads = nthreads ? nthreads : sort_getthreads();
+    sort_executor.threads = (pthread_t *)sort_parallel_malloc(sort_executor.nthreads * sizeof (pthread_t));
+    for (i = 0; i < sort_executor.nthreads; i++) {
+        if (pthread_create(&sort_executor.threads[i], NULL, sort_executor_thread, NULL)) {
+            fprintf(stderr, "Cannot create thread\n");
+            exit(1);
+        }
+    }
+}
+
+int sort_executor_start(size_t nthreads) {
+    pthread_mutex_lock(&sort_executor.lock);
+    if (sort_executor.nthreads || sort_executor.isshuttingdown) {
+        pthread_mutex_unlock(&sort_executor.lock);
+        return -1;
+    }
+    sort_executor_createthreads(nthreads);
+    pthread_mutex_unlock(&sort_executor.lock);
+
+    return 0;
+}
+
+void sort_executor_shutdown(void) {
+    pthread_t *threads;
+    size_t nthreads, i;
+
+    pthread_mutex_lock(&sort_executor.lock);
+    if (!sort_executor.nthreads || sort_executor.isshuttingdown) {
+        pthread_mutex_unlock(&sort_executor.lock);
+        return;
+    }
+    sort_executor.isshuttingdown = TRUE;
+    pthread_cond_broadcast(&sort_executor.queuecond);
+    threads = sort_executor.threads;
+    nthreads = sort_executor.nthreads;
+    pthread_mutex_unlock(&sort_executor.lock);
+
+    /* Wait for the worker threads to run every queued job. */
+    for (i = 0; i < nthreads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    pthread_mutex_lock(&sort_executor.lock);
+    free(threads);
+    free(sort_executor.queue);
+    sort_executor.threads = NULL;
+    sort_executor.nthreads = 0;
+    sort_executor.queue = NULL;
+    sort_executor.queuesize = 0;
+    sort_executor.isshuttingdown = FALSE;
+    pthread_mutex_unlock(&sort_executor.lock);
+}
+
+void sort_executor_getstats(struct sort_executor_stats *stats) {
+    pthread_mutex_lock(&sort_executor.lock);
+    *stats = sort_executor.stats;
+    pthread_mutex_unlock(&sort_executor.lock);
+}
+
+struct sort_job *sort_submit(void *arr, size_t count, size_t elesize,
+    int (*cmp)(const void *, const void *), int priority,
+    void (*callback)(struct sort_job *, int, void *), void *userdata) {
+    struct sort_job *job;
+
+    job = (struct sort_job *)calloc(1, sizeof (struct sort_job));
+    if (!job) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    job->arr = (char *)arr;
+    job->count = count;
+    job->elesize = elesize;
+    job->cmp = cmp;
+    job->priority = priority;
+    job->callback = callback;
+    job->userdata = userdata;
+    job->state = SORT_JOB_QUEUED;
+    clock_gettime(CLOCK_MONOTONIC, &job->submittime);
+
+    pthread_mutex_lock(&sort_executor.lock);
+    if (sort_executor.isshuttingdown) {
+        pthread_mutex_unlock(&sort_executor.lock);
+        free(job);
+        return NULL;
+    }
+
+    /* Start the executor with the default number of threads if needed, while
+     * holding the lock, so that a shutdown cannot stop it before the job is
+     * queued.
+     */
+    if (!sort_executor.nthreads) {
+        sort_executor_createthreads(0);
+    }
+    sort_executor.stats.submitted++;
+    sort_executor_push(job);
+    pthread_mutex_unlock(&sort_executor.lock);
+
+    return job;
+}
+
+int sort_job_poll(struct sort_job *job) {
+    int state;
+
+    pthread_mutex_lock(&sort_executor.lock);
+    state = job->state;
+    pthread_mutex_unlock(&sort_executor.lock);
+
+    return state;
+}
+
+int sort_job_wait(struct sort_job *job) {
+    int state;
+
+    pthread_mutex_lock(&sort_executor.lock);
+    while (job->state != SORT_JOB_DONE && job->state != SORT_JOB_CANCELLED) {
+        pthread_cond_wait(&sort_executor.donecond, &sort_executor.lock);
+    }
+    state = job->state;
+    pthread_mutex_unlock(&sort_executor.lock);
+
+    return state;
+}
+
+int sort_job_cancel(struct sort_job *job) {
+    int ret = 0;
+
+    /* A queued job is finished here. A running job is finished by its worker
+     * thread once the current chunk is done.
+     */
+    pthread_mutex_lock(&sort_executor.lock);
+    if (job->isfinished || job->iscancelled) {
+        ret = -1;
+    } else if (job->isqueued) {
+        sort_executor_remove(job);
+        job->iscancelled = TRUE;
+        sort_job_finish(job, SORT_JOB_CANCELLED);
+    } else {
+        job->iscancelled = TRUE;
+    }
+    pthread_mutex_unlock(&sort_executor.lock);
+
+    return ret;
+}
+
+void sort_job_free(struct sort_job *job) {
+    free(job);
+}
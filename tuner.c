@@ -0,0 +1,290 @@
+/*
+ * tuner.c
+ * Version 20261019
+ * Written by Harry Wong (RedAndBlueEraser)
+ *
+ * Benchmark the tuning parameters of the sorting algorithms on this machine
+ * for every element size class, print the best parameters as sort_tuning.h to
+ * standard output, and report the gain over the build defaults to standard
+ * error.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sort.h"
+
+#define TUNE_ARRLEN 50000
+#define TUNE_SHAPECOUNT 4
+#define TUNE_LASTCLASSSIZE 32
+#define TUNE_MINCLOCKS (CLOCKS_PER_SEC / 10)
+#define TUNE_ROUNDS 5
+#define TUNE_MINGAIN 0.98
+
+/* Candidate quicksort insertion sort thresholds. */
+static const size_t tune_inssortthresholds[] = { 0, 4, 8, 12, 16, 24, 32 };
+
+/* Candidate comb sort shrink factors. */
+static const double tune_shrinkfactors[] = { 1.2, 1.25, 1.3, 1.35, 1.4 };
+
+/* Candidate shellsort gap sequences in descending order, ending with 1 and
+ * padded with 0.
+ */
+static const size_t tune_gapseqs[][SORT_TUNING_GAPSEQ_MAX] = {
+    /* Marcin Ciura's followed by Naoyuki Tokuda's (the build default). */
+    { 40423, 17966, 7985, 3549, 1577, 701, 301, 132, 57, 23, 10, 4, 1 },
+    /* Marcin Ciura's extended by a factor of 2.25. */
+    { 1035711, 460316, 204585, 90927, 40412, 17961, 7983, 3548, 1577, 701, 301, 132, 57, 23, 10, 4, 1 },
+    /* Naoyuki Tokuda's. */
+    { 776591, 345152, 153401, 68178, 30301, 13467, 5985, 2660, 1182, 525, 233, 103, 46, 20, 9, 4, 1 },
+    /* Robert Sedgewick's. */
+    { 1050113, 262913, 65921, 16577, 4193, 1073, 281, 77, 23, 8, 1 }
+};
+
+/* Names of the input shapes of the standard benchmark mix. */
+static const char *tune_shapenames[TUNE_SHAPECOUNT] = { "unsorted", "sorted", "reverse sorted", "uniform" };
+
+/* Comparison function comparing the integer key at the start of elements. */
+static int cmp(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/* Fill the array with elements of the input shape. Each element starts with an
+ * integer key and is padded with bytes up to the element size.
+ */
+static void tune_fillshape(char *arr, size_t elesize, int shape) {
+    size_t i;
+    int key;
+
+    memset(arr, 0xA5, TUNE_ARRLEN * elesize);
+    for (i = 0; i < TUNE_ARRLEN; i++) {
+        key = rand() % 2000001 - 1000000;
+        memcpy(arr + i * elesize, &key, sizeof (int));
+    }
+    if (shape == 1 || shape == 2) {
+        qsort(arr, TUNE_ARRLEN, elesize, cmp);
+    }
+    if (shape == 2) {
+        for (i = 0; i < TUNE_ARRLEN / 2; i++) {
+            memcpy(&key, arr + i * elesize, sizeof (int));
+            memcpy(arr + i * elesize, arr + (TUNE_ARRLEN - 1 - i) * elesize, sizeof (int));
+            memcpy(arr + (TUNE_ARRLEN - 1 - i) * elesize, &key, sizeof (int));
+        }
+    }
+    if (shape == 3) {
+        key = 5;
+        for (i = 0; i < TUNE_ARRLEN; i++) {
+            memcpy(arr + i * elesize, &key, sizeof (int));
+        }
+    }
+}
+
+/* Measure the average number of clock ticks taken to sort a copy of each input
+ * shape, excluding the time taken to copy it. Sorts are repeated until at least
+ * TUNE_MINCLOCKS ticks have passed, so that short sorts are still measured
+ * accurately. Returns the total over all input shapes.
+ */
+static double tune_measure(void (*sort)(void *, size_t, size_t, int (*)(const void *, const void *)),
+    char *shapes[], char *work, size_t elesize) {
+    size_t arrsize = TUNE_ARRLEN * elesize, reps, i;
+    clock_t start, diff, copydiff;
+    double total = 0;
+    int shape;
+
+    for (shape = 0; shape < TUNE_SHAPECOUNT; shape++) {
+        reps = 0;
+        start = clock();
+        do {
+            memcpy(work, shapes[shape], arrsize);
+            sort(work, TUNE_ARRLEN, elesize, cmp);
+            reps++;
+            diff = clock() - start;
+        } while (diff < TUNE_MINCLOCKS);
+
+        start = clock();
+        for (i = 0; i < reps; i++) {
+            memcpy(work, shapes[shape], arrsize);
+        }
+        copydiff = clock() - start;
+
+        total += (double)(diff - (copydiff < diff ? copydiff : 0)) / reps;
+    }
+
+    return total;
+}
+
+/* Measure the sort with two sets of tuning parameters in alternating rounds and
+ * keep the fastest round of each, so that both are measured under the same
+ * machine load and noise is filtered out.
+ */
+static void tune_compare(void (*sort)(void *, size_t, size_t, int (*)(const void *, const void *)),
+    char *shapes[], char *work, size_t elesize, const struct sort_tuning *tuning1,
+    const struct sort_tuning *tuning2, double *time1, double *time2) {
+    double elapsed;
+    int round;
+
+    for (round = 0; round < TUNE_ROUNDS; round++) {
+        sort_settuning(elesize, tuning1);
+        elapsed = tune_measure(sort, shapes, work, elesize);
+        if (round == 0 || elapsed < *time1) {
+            *time1 = elapsed;
+        }
+
+        sort_settuning(elesize, tuning2);
+        elapsed = tune_measure(sort, shapes, work, elesize);
+        if (round == 0 || elapsed < *time2) {
+            *time2 = elapsed;
+        }
+    }
+}
+
+/* Convert clock ticks to milliseconds. */
+static double tune_msec(double ticks) {
+    return ticks * 1000 / CLOCKS_PER_SEC;
+}
+
+int main(void) {
+    size_t classmaxsizes[] = SORT_TUNING_CLASSMAXSIZES,
+        iclass, elesize, i, j;
+    struct sort_tuning defaults, best, candidate, tunings[SORT_TUNING_CLASSCOUNT];
+    char *shapes[TUNE_SHAPECOUNT], *work;
+    double besttime, candidatetime, before[3], after[3], beforetotal = 0, aftertotal = 0;
+    int shape;
+
+    srand(1);
+
+    for (iclass = 0; iclass < SORT_TUNING_CLASSCOUNT; iclass++) {
+        /* Use the largest element size of the class as its representative. */
+        elesize = iclass < SORT_TUNING_CLASSCOUNT - 1 ? classmaxsizes[iclass] : TUNE_LASTCLASSSIZE;
+        if (elesize < sizeof (int)) {
+            elesize = sizeof (int);
+        }
+
+        work = (char *)malloc(TUNE_ARRLEN * elesize);
+        for (shape = 0; shape < TUNE_SHAPECOUNT; shape++) {
+            shapes[shape] = (char *)malloc(TUNE_ARRLEN * elesize);
+            if (!shapes[shape]) {
+                break;
+            }
+            tune_fillshape(shapes[shape], elesize, shape);
+        }
+        if (!work || shape < TUNE_SHAPECOUNT) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+
+        /* Search each parameter in turn, starting from the build defaults. The
+         * parameters belong to separate algorithms, so each is measured with
+         * its own algorithm only. A candidate replaces the best parameters so
+         * far only if it is faster by more than the measurement noise.
+         */
+        sort_gettuning(elesize, &defaults);
+        best = defaults;
+        for (i = 0; i < sizeof (tune_inssortthresholds) / sizeof (tune_inssortthresholds[0]); i++) {
+            candidate = best;
+            candidate.quicksortinssortthres = tune_inssortthresholds[i];
+            if (candidate.quicksortinssortthres == best.quicksortinssortthres) {
+                continue;
+            }
+            tune_compare(sort_quicksort, shapes, work, elesize, &best, &candidate, &besttime, &candidatetime);
+            if (candidatetime < besttime * TUNE_MINGAIN) {
+                best = candidate;
+            }
+        }
+
+        for (i = 0; i < sizeof (tune_shrinkfactors) / sizeof (tune_shrinkfactors[0]); i++) {
+            candidate = best;
+            candidate.combsortshrinkfactor = tune_shrinkfactors[i];
+            if (candidate.combsortshrinkfactor == best.combsortshrinkfactor) {
+                continue;
+            }
+            tune_compare(sort_combsort, shapes, work, elesize, &best, &candidate, &besttime, &candidatetime);
+            if (candidatetime < besttime * TUNE_MINGAIN) {
+                best = candidate;
+            }
+        }
+
+        for (i = 0; i < sizeof (tune_gapseqs) / sizeof (tune_gapseqs[0]); i++) {
+            candidate = best;
+            for (j = 0; j < SORT_TUNING_GAPSEQ_MAX && tune_gapseqs[i][j]; j++) {
+                candidate.shellsortgapseq[j] = tune_gapseqs[i][j];
+            }
+            candidate.shellsortgapseqcount = j;
+            if (!memcmp(candidate.shellsortgapseq, best.shellsortgapseq, j * sizeof (size_t))
+                && candidate.shellsortgapseqcount == best.shellsortgapseqcount) {
+                continue;
+            }
+            tune_compare(sort_shellsort, shapes, work, elesize, &best, &candidate, &besttime, &candidatetime);
+            if (candidatetime < besttime * TUNE_MINGAIN) {
+                best = candidate;
+            }
+        }
+
+        /* Measure the build defaults against the chosen parameters again, and
+         * keep the build default of each algorithm whose chosen parameter is
+         * the build default or not faster by more than the measurement noise,
+         * so that a noisy search cannot make the build slower.
+         */
+        tune_compare(sort_quicksort, shapes, work, elesize, &defaults, &best, &before[0], &after[0]);
+        if (best.quicksortinssortthres == defaults.quicksortinssortthres || after[0] >= before[0] * TUNE_MINGAIN) {
+            best.quicksortinssortthres = defaults.quicksortinssortthres;
+            after[0] = before[0];
+        }
+        tune_compare(sort_combsort, shapes, work, elesize, &defaults, &best, &before[1], &after[1]);
+        if (best.combsortshrinkfactor == defaults.combsortshrinkfactor || after[1] >= before[1] * TUNE_MINGAIN) {
+            best.combsortshrinkfactor = defaults.combsortshrinkfactor;
+            after[1] = before[1];
+        }
+        tune_compare(sort_shellsort, shapes, work, elesize, &defaults, &best, &before[2], &after[2]);
+        if ((best.shellsortgapseqcount == defaults.shellsortgapseqcount
+                && !memcmp(best.shellsortgapseq, defaults.shellsortgapseq, best.shellsortgapseqcount * sizeof (size_t)))
+            || after[2] >= before[2] * TUNE_MINGAIN) {
+            memcpy(best.shellsortgapseq, defaults.shellsortgapseq, sizeof (best.shellsortgapseq));
+            best.shellsortgapseqcount = defaults.shellsortgapseqcount;
+            after[2] = before[2];
+        }
+        tunings[iclass] = best;
+
+        fprintf(stderr, "Element size %lu: insertion sort threshold %lu, shrink factor %.2f, %lu gaps\n",
+            (unsigned long)elesize, (unsigned long)best.quicksortinssortthres,
+            best.combsortshrinkfactor, (unsigned long)best.shellsortgapseqcount);
+        fprintf(stderr, "    Quicksort %.2f ms -> %.2f ms\n", tune_msec(before[0]), tune_msec(after[0]));
+        fprintf(stderr, "    Comb sort %.2f ms -> %.2f ms\n", tune_msec(before[1]), tune_msec(after[1]));
+        fprintf(stderr, "    Shellsort %.2f ms -> %.2f ms\n", tune_msec(before[2]), tune_msec(after[2]));
+        beforetotal += before[0] + before[1] + before[2];
+        aftertotal += after[0] + after[1] + after[2];
+
+        sort_settuning(elesize, &defaults);
+        free(work);
+        for (shape = 0; shape < TUNE_SHAPECOUNT; shape++) {
+            free(shapes[shape]);
+        }
+    }
+    fprintf(stderr, "Benchmark mix (%s", tune_shapenames[0]);
+    for (shape = 1; shape < TUNE_SHAPECOUNT; shape++) {
+        fprintf(stderr, ", %s", tune_shapenames[shape]);
+    }
+    fprintf(stderr, " of %d elements) %.2f ms -> %.2f ms, %.1f%% faster\n",
+        TUNE_ARRLEN, tune_msec(beforetotal), tune_msec(aftertotal),
+        beforetotal > 0 ? (beforetotal - aftertotal) * 100 / beforetotal : 0.0);
+
+    /* Print the tuning parameters as sort_tuning.h. */
+    printf("/*\n");
+    printf(" * sort_tuning.h\n");
+    printf(" * Generated by `make tune`. Do not edit.\n");
+    printf(" */\n");
+    printf("\n");
+    printf("#define SORT_TUNING_TABLE { \\\n");
+    for (iclass = 0; iclass < SORT_TUNING_CLASSCOUNT; iclass++) {
+        printf("    { %lu, %.2f, { ", (unsigned long)tunings[iclass].quicksortinssortthres, tunings[iclass].combsortshrinkfactor);
+        for (j = 0; j < tunings[iclass].shellsortgapseqcount; j++) {
+            printf(j ? ", %lu" : "%lu", (unsigned long)tunings[iclass].shellsortgapseq[j]);
+        }
+        printf(" }, %lu }%s \\\n", (unsigned long)tunings[iclass].shellsortgapseqcount, iclass < SORT_TUNING_CLASSCOUNT - 1 ? "," : "");
+    }
+    printf("}\n");
+
+    return 0;
+}